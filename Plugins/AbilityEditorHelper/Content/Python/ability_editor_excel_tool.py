@@ -7,6 +7,7 @@
 
 import json
 import os
+import struct
 import sys
 from typing import Optional
 
@@ -883,7 +884,7 @@ def export_excel_to_json_using_schema(in_path: str, out_json_path: str, schema_n
     - in_path：
         - xlsx 文件
         - 或 CSV 目录/任一csv文件路径
-    - out_json_path：输出 json（对象数组）
+    - out_json_path：输出 json（对象数组）；以 .aebin 结尾时输出紧凑二进制行文件（见 _write_binary_rows）
     - schema_name_or_path：同 generate_excel_template_from_schema
     """
     schema_dir = schema_dir or _schema_dir_default()
@@ -1054,8 +1055,11 @@ def export_excel_to_json_using_schema(in_path: str, out_json_path: str, schema_n
         result.append(item)
 
     _ensure_dir(out_json_path)
-    with open(out_json_path, "w", encoding="utf-8") as f:
-        json.dump(result, f, ensure_ascii=False, indent=4)
+    if out_json_path.lower().endswith(BINARY_ROWS_EXTENSION):
+        _write_binary_rows(result, str(schema.get("hash") or ""), out_json_path)
+    else:
+        with open(out_json_path, "w", encoding="utf-8") as f:
+            json.dump(result, f, ensure_ascii=False, indent=4)
 
     # 枚举验证结果汇总
     if enum_validation_errors:
@@ -1214,6 +1218,213 @@ def _safe_str(v, default=""):
         return default
     return str(v).strip()
 
+# ===================== 二进制行文件（.aebin） =====================
+# 与 JSON 对象数组等价的紧凑格式，C++ 侧由 FAbilityEditorBinaryRowReader 读取（格式说明见 AbilityEditorBinaryRowReader.h）：
+# - 键名与字符串进入字符串表，Token 中只写索引
+# - 整数为 ZigZag 变长整数，浮点数为 8 字节 double
+# - TagContainer 只写 Tag 列表，ParentTags 由读取端按 _to_tag_container_obj 的规则还原
+# - 文件头记录 Schema 的 hash，结构体变化后旧文件会被拒绝，需要重新导出
+
+BINARY_ROWS_EXTENSION = ".aebin"
+
+_BINARY_MAGIC = b"AERB"
+_BINARY_VERSION = 1
+
+_OP_OBJECT_START = 0
+_OP_OBJECT_END = 1
+_OP_ARRAY_START = 2
+_OP_ARRAY_END = 3
+_OP_NULL = 4
+_OP_FALSE = 5
+_OP_TRUE = 6
+_OP_INT = 7
+_OP_FLOAT = 8
+_OP_STRING = 9
+_OP_TAG_CONTAINER = 10
+_OP_HAS_KEY = 0x80
+
+def _write_varint(buf: bytearray, value: int):
+    while True:
+        b = value & 0x7F
+        value >>= 7
+        if value:
+            buf.append(b | 0x80)
+        else:
+            buf.append(b)
+            return
+
+def _read_varint(data: bytes, pos: int) -> tuple:
+    value = 0
+    shift = 0
+    while True:
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        if not (b & 0x80):
+            return value, pos
+        shift += 7
+
+def _write_binary_string(buf: bytearray, s: str):
+    data = s.encode("utf-8")
+    _write_varint(buf, len(data))
+    buf += data
+
+class _BinaryStringTable:
+    def __init__(self):
+        self.items = []
+        self._index = {}
+
+    def get(self, s: str) -> int:
+        idx = self._index.get(s)
+        if idx is None:
+            idx = len(self.items)
+            self._index[s] = idx
+            self.items.append(s)
+        return idx
+
+def _as_tag_list(value):
+    """value 恰好是 _to_tag_container_obj 的结果时返回其 Tag 列表，否则返回 None"""
+    if not isinstance(value, dict) or list(value.keys()) != ["GameplayTags", "ParentTags"]:
+        return None
+    tags = []
+    for t in value["GameplayTags"] if isinstance(value["GameplayTags"], list) else [None]:
+        if not isinstance(t, dict) or list(t.keys()) != ["TagName"] or not isinstance(t["TagName"], str):
+            return None
+        tags.append(t["TagName"])
+    return tags if _to_tag_container_obj(tags) == value else None
+
+def _encode_binary_value(buf: bytearray, strings: _BinaryStringTable, key, value):
+    def op(code: int):
+        if key is None:
+            buf.append(code)
+        else:
+            buf.append(code | _OP_HAS_KEY)
+            _write_varint(buf, strings.get(key))
+
+    tags = _as_tag_list(value)
+    if tags is not None:
+        op(_OP_TAG_CONTAINER)
+        _write_varint(buf, len(tags))
+        for t in tags:
+            _write_varint(buf, strings.get(t))
+    elif value is None:
+        op(_OP_NULL)
+    elif isinstance(value, bool):
+        op(_OP_TRUE if value else _OP_FALSE)
+    elif isinstance(value, int) and -(1 << 63) <= value < (1 << 63):
+        op(_OP_INT)
+        _write_varint(buf, value * 2 if value >= 0 else -value * 2 - 1)
+    elif isinstance(value, (int, float)):
+        op(_OP_FLOAT)
+        buf += struct.pack("<d", float(value))
+    elif isinstance(value, str):
+        op(_OP_STRING)
+        _write_varint(buf, strings.get(value))
+    elif isinstance(value, dict):
+        op(_OP_OBJECT_START)
+        for k, v in value.items():
+            _encode_binary_value(buf, strings, str(k), v)
+        buf.append(_OP_OBJECT_END)
+    elif isinstance(value, (list, tuple)):
+        op(_OP_ARRAY_START)
+        for v in value:
+            _encode_binary_value(buf, strings, None, v)
+        buf.append(_OP_ARRAY_END)
+    else:
+        raise TypeError(f"无法写入二进制行文件的值类型：{type(value).__name__}")
+
+def _write_binary_rows(rows: list, schema_hash: str, out_path: str):
+    strings = _BinaryStringTable()
+    encoded_rows = []
+    for row in rows:
+        buf = bytearray()
+        _encode_binary_value(buf, strings, None, row)
+        encoded_rows.append(buf)
+
+    out = bytearray(_BINARY_MAGIC)
+    out.append(_BINARY_VERSION)
+    _write_binary_string(out, schema_hash)
+    _write_varint(out, len(strings.items))
+    for s in strings.items:
+        _write_binary_string(out, s)
+    _write_varint(out, len(encoded_rows))
+    for r in encoded_rows:
+        _write_varint(out, len(r))
+        out += r
+
+    with open(out_path, "wb") as f:
+        f.write(out)
+
+def read_binary_rows(path: str) -> tuple:
+    """读取 .aebin 文件，返回 (schema_hash, rows)；rows 与导出为 JSON 时的对象数组相同（用于校验与调试）"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != _BINARY_MAGIC or data[4] != _BINARY_VERSION:
+        raise ValueError(f"不是有效的二进制行文件（或版本不匹配）：{path}")
+
+    def read_string(pos: int) -> tuple:
+        n, pos = _read_varint(data, pos)
+        return data[pos:pos + n].decode("utf-8"), pos + n
+
+    schema_hash, pos = read_string(5)
+    count, pos = _read_varint(data, pos)
+    strings = []
+    for _ in range(count):
+        s, pos = read_string(pos)
+        strings.append(s)
+
+    def read_value(pos: int) -> tuple:
+        """返回 (键名或 None, 值, 下一个位置)"""
+        code = data[pos]
+        pos += 1
+        key = None
+        if code & _OP_HAS_KEY:
+            code &= 0x7F
+            idx, pos = _read_varint(data, pos)
+            key = strings[idx]
+
+        if code == _OP_TAG_CONTAINER:
+            n, pos = _read_varint(data, pos)
+            tags = []
+            for _ in range(n):
+                idx, pos = _read_varint(data, pos)
+                tags.append(strings[idx])
+            return key, _to_tag_container_obj(tags), pos
+        if code == _OP_NULL:
+            return key, None, pos
+        if code in (_OP_FALSE, _OP_TRUE):
+            return key, code == _OP_TRUE, pos
+        if code == _OP_INT:
+            z, pos = _read_varint(data, pos)
+            return key, (z >> 1) if not (z & 1) else -((z + 1) >> 1), pos
+        if code == _OP_FLOAT:
+            return key, struct.unpack_from("<d", data, pos)[0], pos + 8
+        if code == _OP_STRING:
+            idx, pos = _read_varint(data, pos)
+            return key, strings[idx], pos
+        if code == _OP_OBJECT_START:
+            obj = {}
+            while data[pos] != _OP_OBJECT_END:
+                member_key, value, pos = read_value(pos)
+                obj[member_key] = value
+            return key, obj, pos + 1
+        if code == _OP_ARRAY_START:
+            arr = []
+            while data[pos] != _OP_ARRAY_END:
+                _, value, pos = read_value(pos)
+                arr.append(value)
+            return key, arr, pos + 1
+        raise ValueError(f"未知的操作码 {code}（位置 {pos - 1}）")
+
+    rows = []
+    row_count, pos = _read_varint(data, pos)
+    for _ in range(row_count):
+        size, pos = _read_varint(data, pos)
+        _, row, _ = read_value(pos)
+        rows.append(row)
+        pos += size
+    return schema_hash, rows
+
 if __name__ == "__main__":
     # 命令行用法（在外部Python环境下也可调试）
     # 1) Schema 模板：python ability_editor_excel_tool.py schema_template <schema> <输出路径/目录> [--schema-dir DIR]
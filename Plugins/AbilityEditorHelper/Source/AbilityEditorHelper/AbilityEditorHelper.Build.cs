@@ -63,6 +63,9 @@ public class AbilityEditorHelper : ModuleRules
 					"ToolMenus",     // UToolMenus 菜单扩展
 					"UMG",
 					"UMGEditor",      // UWidgetBlueprint 基类
+					"DirectoryWatcher", // 监视模式：Excel/JSON 目录变化
+					"FileUtilities", // FZipArchiveReader：原生读取 xlsx
+					"SourceControl", // 批量保存前签出
 				}
 			);
 		}
@@ -0,0 +1,155 @@
+// AbilityEditorAssetPathCache.cpp
+
+#include "AbilityEditorAssetPathCache.h"
+#include "AbilityEditorBulkImportScope.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectGlobals.h"
+
+#if WITH_EDITOR
+#include "AssetRegistry/AssetRegistryModule.h"
+#endif
+
+FAbilityEditorAssetPathCache& FAbilityEditorAssetPathCache::Get()
+{
+	static FAbilityEditorAssetPathCache Instance;
+	return Instance;
+}
+
+UClass* FAbilityEditorAssetPathCache::FindOrLoadClass(const FString& ObjectPath, UClass* BaseClass, bool* bOutFirstFailure)
+{
+	return static_cast<UClass*>(FindOrLoad(ObjectPath, BaseClass, true, bOutFirstFailure));
+}
+
+UObject* FAbilityEditorAssetPathCache::FindOrLoadObject(const FString& ObjectPath, UClass* ObjectClass, bool* bOutFirstFailure)
+{
+	return FindOrLoad(ObjectPath, ObjectClass, false, bOutFirstFailure);
+}
+
+UObject* FAbilityEditorAssetPathCache::FindOrLoad(const FString& ObjectPath, UClass* Class, bool bLoadClass, bool* bOutFirstFailure)
+{
+	check(IsInGameThread());
+	if (bOutFirstFailure)
+	{
+		*bOutFirstFailure = false;
+	}
+
+	auto Load = [&ObjectPath, Class, bLoadClass]() -> UObject*
+	{
+		return bLoadClass ? StaticLoadClass(Class, nullptr, *ObjectPath) : StaticLoadObject(Class, nullptr, *ObjectPath);
+	};
+
+	// 作用域外不缓存：导入之外的调用可能跨越资产修改
+	if (!FAbilityEditorBulkImportScope::IsActive())
+	{
+		UObject* Loaded = Load();
+		if (!Loaded && bOutFirstFailure)
+		{
+			*bOutFirstFailure = true;
+		}
+		return Loaded;
+	}
+
+	const FKey Key(FName(*ObjectPath), Class, bLoadClass);
+	if (const FEntry* Entry = Entries.Find(Key))
+	{
+		if (Entry->bMissing)
+		{
+			return nullptr;
+		}
+		if (UObject* Cached = Entry->Object.Get())
+		{
+			return Cached;
+		}
+		// 对象已被删除或回收：重新加载
+	}
+
+	UObject* Loaded = Load();
+	FEntry& NewEntry = Entries.Add(Key);
+	NewEntry.Object = Loaded;
+	NewEntry.PackageName = FName(*FPackageName::ObjectPathToPackageName(ObjectPath));
+	NewEntry.bMissing = (Loaded == nullptr);
+
+	if (!Loaded && bOutFirstFailure)
+	{
+		*bOutFirstFailure = true;
+	}
+	return Loaded;
+}
+
+void FAbilityEditorAssetPathCache::Reset()
+{
+	Entries.Reset();
+}
+
+void FAbilityEditorAssetPathCache::InvalidatePackage(FName PackageName)
+{
+	if (Entries.Num() == 0)
+	{
+		return;
+	}
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It->Value.PackageName == PackageName)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FAbilityEditorAssetPathCache::RegisterInvalidationDelegates()
+{
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		Reset();
+	});
+
+#if WITH_EDITOR
+	// 蓝图重新编译后旧类被替换，缓存的类指针不再可用
+	ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([this](const FCoreUObjectDelegates::FReplacementObjectMap&)
+	{
+		Reset();
+	});
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FAbilityEditorAssetPathCache::OnAssetAdded);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FAbilityEditorAssetPathCache::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FAbilityEditorAssetPathCache::OnAssetRenamed);
+#endif
+}
+
+void FAbilityEditorAssetPathCache::UnregisterInvalidationDelegates()
+{
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+#endif
+
+	Reset();
+}
+
+void FAbilityEditorAssetPathCache::OnAssetAdded(const FAssetData& AssetData)
+{
+	// 新建的资产可能正是之前加载失败的路径
+	InvalidatePackage(AssetData.PackageName);
+}
+
+void FAbilityEditorAssetPathCache::OnAssetRemoved(const FAssetData& AssetData)
+{
+	InvalidatePackage(AssetData.PackageName);
+}
+
+void FAbilityEditorAssetPathCache::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	InvalidatePackage(AssetData.PackageName);
+	InvalidatePackage(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+}
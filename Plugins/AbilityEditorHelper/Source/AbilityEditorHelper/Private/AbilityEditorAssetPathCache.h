@@ -0,0 +1,72 @@
+// AbilityEditorAssetPathCache.h
+// 导入会话内的类/对象路径解析缓存（LoadClassFromPath / LoadObjectFromPath 使用）
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+struct FAssetData;
+
+/**
+ * 按对象路径缓存 LoadClass / LoadObject 的结果
+ * - 键为规范化的对象路径 + 请求的类型 + 加载方式（类 / 对象），同一路径在一次批量导入中只加载一次
+ * - 加载失败的路径同样缓存（负缓存），不会逐行重试；调用方据 bOutFirstFailure 只输出一次警告
+ * - 仅在批量导入作用域（FAbilityEditorBulkImportScope）内缓存，最外层作用域结束时清空；作用域外直接加载
+ * - 热重载、蓝图重新实例化时整体失效；资产新建、重命名、删除时对应包的条目失效
+ * - 仅在游戏线程使用
+ */
+class FAbilityEditorAssetPathCache : public FNoncopyable
+{
+public:
+	static FAbilityEditorAssetPathCache& Get();
+
+	/**
+	 * 加载类（等价于 StaticLoadClass(BaseClass, nullptr, ObjectPath)）
+	 * @param bOutFirstFailure  加载失败且为本次导入会话中首次失败时为 true（作用域外每次失败都为 true）
+	 */
+	UClass* FindOrLoadClass(const FString& ObjectPath, UClass* BaseClass, bool* bOutFirstFailure = nullptr);
+
+	/**
+	 * 加载对象（等价于 StaticLoadObject(ObjectClass, nullptr, ObjectPath)）
+	 * @param bOutFirstFailure  同 FindOrLoadClass
+	 */
+	UObject* FindOrLoadObject(const FString& ObjectPath, UClass* ObjectClass, bool* bOutFirstFailure = nullptr);
+
+	/** 清空全部条目 */
+	void Reset();
+
+	/** 使指定包下的条目失效（包括负缓存） */
+	void InvalidatePackage(FName PackageName);
+
+	/** 注册热重载与资产注册表事件（模块启动时调用） */
+	void RegisterInvalidationDelegates();
+
+	/** 注销事件（模块关闭时调用） */
+	void UnregisterInvalidationDelegates();
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<UObject> Object;
+		FName PackageName;
+		bool bMissing = false;
+	};
+
+	/** 对象路径、请求的类型、是否按类加载（同一路径先按类加载失败后仍可按对象加载） */
+	using FKey = TTuple<FName, const UClass*, bool>;
+
+	UObject* FindOrLoad(const FString& ObjectPath, UClass* Class, bool bLoadClass, bool* bOutFirstFailure);
+
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	TMap<FKey, FEntry> Entries;
+
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle ObjectsReinstancedHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+};
@@ -0,0 +1,159 @@
+// AbilityEditorAssetStamp.cpp
+
+#include "AbilityEditorAssetStamp.h"
+#include "AbilityEditorBulkImportScope.h"
+#include "AbilityEditorHelperSettings.h"
+#include "AbilityEditorImportManifest.h"
+#include "AbilityEditorStructHash.h"
+#include "Hash/xxhash.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/DataTable.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+
+#if WITH_EDITOR
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/MetaData.h"
+#endif
+
+const FName FAbilityEditorAssetStamp::MetaDataKey(TEXT("AbilityEditorConfigStamp"));
+const FName FAbilityEditorAssetStamp::SourceTableKey(TEXT("AbilityEditorSourceTable"));
+const FName FAbilityEditorAssetStamp::SourceRowKey(TEXT("AbilityEditorSourceRow"));
+
+namespace
+{
+	/** 印记格式版本，计算方式或写入内容变化时递增以使旧印记失效（2：同时写入来源标签） */
+	constexpr uint64 StampFormatVersion = 2;
+}
+
+void FAbilityEditorAssetStamp::RegisterAssetRegistryTag()
+{
+#if WITH_EDITOR
+	TSet<FName>& Tags = UObject::GetMetaDataTagsForAssetRegistry();
+	Tags.Add(MetaDataKey);
+	Tags.Add(SourceTableKey);
+	Tags.Add(SourceRowKey);
+#endif
+}
+
+void FAbilityEditorAssetStamp::UnregisterAssetRegistryTag()
+{
+#if WITH_EDITOR
+	TSet<FName>& Tags = UObject::GetMetaDataTagsForAssetRegistry();
+	Tags.Remove(MetaDataKey);
+	Tags.Remove(SourceTableKey);
+	Tags.Remove(SourceRowKey);
+#endif
+}
+
+uint64 FAbilityEditorAssetStamp::MakeContextHash(const UAbilityEditorHelperSettings* Settings, const FString& SchemaHash)
+{
+	FXxHash64Builder Builder;
+	auto HashString = [&Builder](const FString& Value)
+	{
+		const int32 Len = Value.Len();
+		Builder.Update(&Len, sizeof(Len));
+		Builder.Update(*Value, Len * sizeof(TCHAR));
+	};
+	auto HashUInt64 = [&Builder](uint64 Value)
+	{
+		Builder.Update(&Value, sizeof(Value));
+	};
+
+	HashUInt64(StampFormatVersion);
+	HashUInt64(Settings ? Settings->GetGenerationSettingsHash() : 0);
+	HashString(SchemaHash);
+
+	// 插件版本：生成逻辑升级后所有资产都需要重新应用配置
+	if (const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("AbilityEditorHelper")))
+	{
+		HashUInt64(static_cast<uint64>(Plugin->GetDescriptor().Version));
+		HashString(Plugin->GetDescriptor().VersionName);
+	}
+
+	return Builder.Finalize().Hash;
+}
+
+FString FAbilityEditorAssetStamp::Make(uint64 ContextHash, const UScriptStruct* RowStruct, const void* RowData)
+{
+	const uint64 Hashes[2] = { ContextHash, FAbilityEditorStructHash::HashStruct(RowStruct, RowData) };
+	return FAbilityEditorImportManifest::HashToString(FXxHash64::HashBuffer(Hashes, sizeof(Hashes)).Hash);
+}
+
+FString FAbilityEditorAssetStamp::Find(const FString& AssetPath)
+{
+#if WITH_EDITOR
+	FString ObjectPath = AssetPath;
+	if (!ObjectPath.Contains(TEXT(".")))
+	{
+		ObjectPath = AssetPath + TEXT(".") + FPackageName::GetLongPackageAssetName(AssetPath);
+	}
+
+	// 已加载：读取内存中的包元数据（可能尚未保存，注册表标签为旧值）
+	if (const UObject* Loaded = FindObject<UObject>(nullptr, *ObjectPath))
+	{
+		return Loaded->GetPackage()->GetMetaData().GetValue(Loaded, MetaDataKey);
+	}
+
+	// 未加载：读取资产注册表标签
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath));
+	FString Stamp;
+	if (AssetData.IsValid())
+	{
+		AssetData.GetTagValue(MetaDataKey, Stamp);
+	}
+	return Stamp;
+#else
+	return FString();
+#endif
+}
+
+bool FAbilityEditorAssetStamp::Apply(UObject* Asset, const FString& Stamp, const UDataTable* SourceTable, FName SourceRow)
+{
+#if WITH_EDITOR
+	if (!Asset)
+	{
+		return false;
+	}
+
+	const FString SourceTablePath = SourceTable ? SourceTable->GetPathName() : FString();
+	const FString SourceRowName = SourceRow.ToString();
+
+	FMetaData& MetaData = Asset->GetPackage()->GetMetaData();
+	if (MetaData.GetValue(Asset, MetaDataKey) == Stamp
+		&& MetaData.GetValue(Asset, SourceTableKey) == SourceTablePath
+		&& MetaData.GetValue(Asset, SourceRowKey) == SourceRowName)
+	{
+		return false;
+	}
+
+	// 印记只存在于包元数据中，对象序列化比较察觉不到，需单独标记脏包才能随资产保存
+	MetaData.SetValue(Asset, MetaDataKey, *Stamp);
+	MetaData.SetValue(Asset, SourceTableKey, *SourceTablePath);
+	MetaData.SetValue(Asset, SourceRowKey, *SourceRowName);
+	FAbilityEditorBulkImportScope::MarkPackageDirty(Asset);
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool FAbilityEditorAssetStamp::ReadFromAssetData(const FAssetData& AssetData, FString& OutSourceTable, FName& OutSourceRow, FString& OutStamp)
+{
+	OutSourceTable.Reset();
+	OutSourceRow = NAME_None;
+	OutStamp.Reset();
+
+	FString SourceRowName;
+	if (!AssetData.GetTagValue(SourceTableKey, OutSourceTable) || OutSourceTable.IsEmpty()
+		|| !AssetData.GetTagValue(SourceRowKey, SourceRowName))
+	{
+		return false;
+	}
+
+	OutSourceRow = FName(*SourceRowName);
+	AssetData.GetTagValue(MetaDataKey, OutStamp);
+	return true;
+}
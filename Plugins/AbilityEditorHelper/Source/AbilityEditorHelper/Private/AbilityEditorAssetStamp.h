@@ -0,0 +1,66 @@
+// AbilityEditorAssetStamp.h
+// 生成资产的配置印记与来源标签（批量生成、清理与过期报告使用）
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDataTable;
+class UAbilityEditorHelperSettings;
+class UScriptStruct;
+struct FAssetData;
+
+/**
+ * 配置印记：生成资产时写入其包元数据的字符串，记录"由哪一份配置、哪个版本的生成逻辑生成"
+ * - 印记 = 行配置内容哈希 + 行结构 Schema Hash + 影响生成结果的设置的哈希 + 插件版本
+ * - 同时写入来源 DataTable 路径与行名，用于判断资产归属（孤儿检测、清理、过期报告）
+ * - 元数据键登记到 UObject::GetMetaDataTagsForAssetRegistry，保存后作为资产注册表标签可见，
+ *   因此未加载的资产只需一次注册表查询即可比较印记，无需加载资产
+ * - 批量生成时印记一致的行直接跳过，不加载资产、不应用配置、也不做前后序列化比较
+ * - 仅编辑器可用；非编辑器环境下 Find 总是返回空字符串
+ */
+struct FAbilityEditorAssetStamp
+{
+	/** 包元数据 / 资产注册表标签的键：配置印记 */
+	static const FName MetaDataKey;
+
+	/** 包元数据 / 资产注册表标签的键：来源 DataTable 的对象路径 */
+	static const FName SourceTableKey;
+
+	/** 包元数据 / 资产注册表标签的键：来源行名 */
+	static const FName SourceRowKey;
+
+	/** 将印记键登记为资产注册表标签（模块启动时调用） */
+	static void RegisterAssetRegistryTag();
+
+	/** 取消登记（模块关闭时调用） */
+	static void UnregisterAssetRegistryTag();
+
+	/**
+	 * 计算一次批量生成中所有行共享的部分（影响生成结果的设置、Schema、插件版本）
+	 * @param SchemaHash  行结构的 Schema Hash
+	 */
+	static uint64 MakeContextHash(const UAbilityEditorHelperSettings* Settings, const FString& SchemaHash);
+
+	/** 计算单行的印记 */
+	static FString Make(uint64 ContextHash, const UScriptStruct* RowStruct, const void* RowData);
+
+	/**
+	 * 读取资产当前的印记：资产已加载时读取包元数据，否则读取资产注册表标签（不加载资产）
+	 * @param AssetPath  包路径（/Game/Dir/Asset）或对象路径（/Game/Dir/Asset.Asset）
+	 * @return           资产不存在或没有印记时返回空字符串
+	 */
+	static FString Find(const FString& AssetPath);
+
+	/**
+	 * 写入印记与来源；与现有值不同时标记脏包（经由批量导入作用域）
+	 * @return  是否发生变化
+	 */
+	static bool Apply(UObject* Asset, const FString& Stamp, const UDataTable* SourceTable, FName SourceRow);
+
+	/**
+	 * 从资产注册表数据读取来源与印记（不加载资产）
+	 * @return  资产带有来源标签时返回 true
+	 */
+	static bool ReadFromAssetData(const FAssetData& AssetData, FString& OutSourceTable, FName& OutSourceRow, FString& OutStamp);
+};
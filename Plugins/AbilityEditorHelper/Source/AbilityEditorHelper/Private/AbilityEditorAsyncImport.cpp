@@ -0,0 +1,392 @@
+// AbilityEditorAsyncImport.cpp
+
+#include "AbilityEditorAsyncImport.h"
+#include "AbilityEditorImportJob.h"
+#include "AbilityEditorBulkImportScope.h"
+#include "AbilityEditorHelperLibrary.h"
+#include "AbilityEditorHelperSettings.h"
+#include "AbilityEditorRowAssetType.h"
+#include "AbilityEditorTypes.h"
+#include "UObject/Package.h"
+
+#if WITH_EDITOR
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "AbilityEditorAsyncImport"
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::Create(const TSharedRef<FAbilityEditorImportJob>& InJob)
+{
+	UAbilityEditorAsyncImport* Action = NewObject<UAbilityEditorAsyncImport>();
+	Action->Job = InJob;
+	return Action;
+}
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::CreateOrUpdateGameplayEffectsFromSettingsAsync(bool bClearGameplayEffectFolderFirst, bool bForceFullUpdate)
+{
+	return Create(FAbilityEditorImportJob::MakeTableGenerationJob(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect), bClearGameplayEffectFolderFirst, bForceFullUpdate));
+}
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::CreateOrUpdateGameplayAbilitiesFromSettingsAsync(bool bClearGameplayAbilityFolderFirst, bool bForceFullUpdate)
+{
+	return Create(FAbilityEditorImportJob::MakeTableGenerationJob(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility), bClearGameplayAbilityFolderFirst, bForceFullUpdate));
+}
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::CreateOrUpdateGameplayEffectsAndAbilitiesFromSettingsAsync(bool bClearFoldersFirst, bool bForceFullUpdate)
+{
+	const TArray<FName> RowTypes = {
+		FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect),
+		FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility)
+	};
+	return Create(FAbilityEditorImportJob::MakeUnifiedGenerationJob(RowTypes, bClearFoldersFirst, bForceFullUpdate));
+}
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::ImportAndUpdateGameplayEffectsFromJsonAsync(const FString& JsonFileName, bool bClearGameplayEffectFolderFirst)
+{
+	return Create(FAbilityEditorImportJob::MakeJsonImportJob(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect), JsonFileName, bClearGameplayEffectFolderFirst));
+}
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::ImportAndUpdateGameplayAbilitiesFromJsonAsync(const FString& JsonFileName, bool bClearGameplayAbilityFolderFirst)
+{
+	return Create(FAbilityEditorImportJob::MakeJsonImportJob(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility), JsonFileName, bClearGameplayAbilityFolderFirst));
+}
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::ImportAndUpdateGameplayEffectsFromExcelAsync(const FString& ExcelFileName, bool bClearGameplayEffectFolderFirst)
+{
+	return Create(FAbilityEditorImportJob::MakeExcelImportJob(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect), ExcelFileName, bClearGameplayEffectFolderFirst));
+}
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::ImportAndUpdateGameplayAbilitiesFromExcelAsync(const FString& ExcelFileName, bool bClearGameplayAbilityFolderFirst)
+{
+	return Create(FAbilityEditorImportJob::MakeExcelImportJob(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility), ExcelFileName, bClearGameplayAbilityFolderFirst));
+}
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::CreateOrUpdateRowTypeAssetsAsync(FName RowType, bool bClearFolderFirst, bool bForceFullUpdate)
+{
+	return Create(FAbilityEditorImportJob::MakeTableGenerationJob(RowType, bClearFolderFirst, bForceFullUpdate));
+}
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::ImportAndUpdateRowTypeFromJsonAsync(FName RowType, const FString& JsonFileName, bool bClearFolderFirst)
+{
+	return Create(FAbilityEditorImportJob::MakeJsonImportJob(RowType, JsonFileName, bClearFolderFirst));
+}
+
+UAbilityEditorAsyncImport* UAbilityEditorAsyncImport::ImportAndUpdateRowTypeFromExcelAsync(FName RowType, const FString& ExcelFileName, bool bClearFolderFirst)
+{
+	return Create(FAbilityEditorImportJob::MakeExcelImportJob(RowType, ExcelFileName, bClearFolderFirst));
+}
+
+bool UAbilityEditorAsyncImport::IsAnyImportRunning()
+{
+	return FAbilityEditorImportJob::IsAsyncImportRunning();
+}
+
+float UAbilityEditorAsyncImport::GetProgress() const
+{
+	if (Phase == EPhase::Finished)
+	{
+		return 1.f;
+	}
+	return NumSteps > 0 ? static_cast<float>(NumStepsDone) / NumSteps : 0.f;
+}
+
+void UAbilityEditorAsyncImport::Cancel()
+{
+	if (IsRunning() && CancelRequested.IsValid() && !*CancelRequested)
+	{
+		UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 已请求取消 %s，将在当前行处理完后停止"), *Job->GetDisplayName().ToString());
+		*CancelRequested = true;
+	}
+}
+
+void UAbilityEditorAsyncImport::Activate()
+{
+	if (Phase != EPhase::Idle || !Job.IsValid())
+	{
+		return;
+	}
+
+	if (FAbilityEditorImportJob::IsAsyncImportRunning())
+	{
+		UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 已有异步导入正在进行，已拒绝 %s"), *Job->GetDisplayName().ToString());
+		EndImport(false, false);
+		return;
+	}
+
+	// 导入期间保持存活（编辑器中没有可注册的 GameInstance）
+	AddToRoot();
+	FAbilityEditorImportJob::SetAsyncImportRunning(true);
+	CancelRequested = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(false);
+	Job->EnableCancellation();
+
+	bool bSuccess = false;
+	if (!Job->Prepare(bSuccess))
+	{
+		EndImport(bSuccess, false);
+		return;
+	}
+
+	ShowNotification();
+
+	if (Job->CanRunDataStageOffGameThread())
+	{
+		// 纯数据阶段在工作线程执行，批与批之间检查取消
+		Phase = EPhase::DataBackground;
+		DataTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [TaskJob = Job, TaskCancelRequested = CancelRequested]()
+		{
+			EAbilityEditorImportStepResult Result = EAbilityEditorImportStepResult::Continue;
+			while (Result == EAbilityEditorImportStepResult::Continue && !*TaskCancelRequested)
+			{
+				Result = TaskJob->ExecuteDataStep();
+			}
+			return Result == EAbilityEditorImportStepResult::Done;
+		});
+	}
+	else
+	{
+		Phase = EPhase::DataGameThread;
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UAbilityEditorAsyncImport::Tick));
+}
+
+bool UAbilityEditorAsyncImport::Tick(float DeltaTime)
+{
+	const UAbilityEditorHelperSettings* Settings = GetDefault<UAbilityEditorHelperSettings>();
+	const double Deadline = FPlatformTime::Seconds() + FMath::Max(Settings->AsyncImportFrameBudgetMs, 1.f) / 1000.0;
+
+	if (Phase == EPhase::DataBackground)
+	{
+		if (!DataTask.IsCompleted())
+		{
+			return true;
+		}
+		if (*CancelRequested || !DataTask.GetResult())
+		{
+			// 数据阶段尚未修改任何资产，直接结束
+			EndImport(false, *CancelRequested);
+			return false;
+		}
+		if (!BeginAssetStage())
+		{
+			return false;
+		}
+	}
+	else if (Phase == EPhase::DataGameThread)
+	{
+		// 行结构需要在游戏线程绑定：每帧处理若干批，每帧至少一批
+		EAbilityEditorImportStepResult Result = EAbilityEditorImportStepResult::Continue;
+		do
+		{
+			Result = Job->ExecuteDataStep();
+		}
+		while (Result == EAbilityEditorImportStepResult::Continue && !*CancelRequested && FPlatformTime::Seconds() < Deadline);
+
+		if (*CancelRequested || Result == EAbilityEditorImportStepResult::Failed)
+		{
+			EndImport(false, *CancelRequested);
+			return false;
+		}
+		if (Result == EAbilityEditorImportStepResult::Continue)
+		{
+			return true;
+		}
+		if (!BeginAssetStage())
+		{
+			return false;
+		}
+	}
+
+	if (Phase != EPhase::Assets)
+	{
+		return false;
+	}
+
+	if (!*CancelRequested)
+	{
+		RunAssetSteps(Deadline);
+	}
+
+	if (*CancelRequested || NumStepsDone >= NumSteps)
+	{
+		Complete(*CancelRequested);
+		return false;
+	}
+
+	UpdateNotification();
+	OnProgress.Broadcast(NumStepsDone, NumSteps, false);
+	return true;
+}
+
+bool UAbilityEditorAsyncImport::BeginAssetStage()
+{
+	Phase = EPhase::Assets;
+	UpdatedRowNames = Job->GetUpdatedRowNames();
+
+	bool bBegun = false;
+	{
+		FAbilityEditorBulkImportScope BulkImportScope;
+		bBegun = Job->BeginAssetStage();
+		for (UPackage* Package : BulkImportScope.GetTouchedPackages())
+		{
+			TouchedPackages.Add(Package);
+		}
+	}
+
+	if (!bBegun)
+	{
+		EndImport(false, false);
+		return false;
+	}
+
+	NumSteps = Job->GetNumAssetSteps();
+	UpdateNotification();
+	return true;
+}
+
+void UAbilityEditorAsyncImport::RunAssetSteps(double Deadline)
+{
+	// 每帧一个最外层作用域：通知在帧末刷新，撤销记录只在本帧内暂停
+	FAbilityEditorBulkImportScope BulkImportScope;
+	while (NumStepsDone < NumSteps && !*CancelRequested)
+	{
+		Job->ExecuteAssetStep(NumStepsDone);
+		++NumStepsDone;
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			break;
+		}
+	}
+
+	// 重复的包（如 DataTable）在结束时的作用域中去重
+	for (UPackage* Package : BulkImportScope.GetTouchedPackages())
+	{
+		TouchedPackages.Add(Package);
+	}
+}
+
+void UAbilityEditorAsyncImport::Complete(bool bCancelled)
+{
+	bool bSuccess = false;
+	{
+		// 各帧的作用域均已结束，在新的最外层作用域中重新登记仍未保存的包，供可选的统一保存
+		FAbilityEditorBulkImportScope BulkImportScope;
+		for (const TWeakObjectPtr<UPackage>& Package : TouchedPackages)
+		{
+			if (Package.IsValid() && Package->IsDirty())
+			{
+				FAbilityEditorBulkImportScope::MarkPackageDirty(Package.Get());
+			}
+		}
+		TouchedPackages.Empty();
+
+		bSuccess = Job->Finish(BulkImportScope, NumStepsDone);
+	}
+
+	EndImport(bSuccess && !bCancelled, bCancelled);
+}
+
+void UAbilityEditorAsyncImport::EndImport(bool bSuccess, bool bCancelled)
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	Phase = EPhase::Finished;
+
+	CloseNotification(bSuccess, bCancelled);
+	if (bCancelled)
+	{
+		OnCancelled.Broadcast(NumStepsDone, NumSteps, false);
+	}
+	else
+	{
+		OnCompleted.Broadcast(NumStepsDone, NumSteps, bSuccess);
+	}
+
+	// 释放任务（及其持有的 DataTable 引用）
+	Job.Reset();
+	SetReadyToDestroy();
+
+	// 只有实际开始过的导入持有"正在进行"标记（开始时 AddToRoot）
+	if (IsRooted())
+	{
+		FAbilityEditorImportJob::SetAsyncImportRunning(false);
+		RemoveFromRoot();
+	}
+}
+
+void UAbilityEditorAsyncImport::ShowNotification()
+{
+#if WITH_EDITOR
+	if (!FSlateApplication::IsInitialized())
+	{
+		return;
+	}
+
+	FNotificationInfo Info(FText::Format(LOCTEXT("Preparing", "{0}：正在读取与比较数据…"), Job->GetDisplayName()));
+	Info.bFireAndForget = false;
+	Info.bUseThrobber = true;
+	Info.bUseSuccessFailIcons = true;
+	Info.FadeOutDuration = 1.f;
+	Info.ExpireDuration = 3.f;
+	Info.ButtonDetails.Add(FNotificationButtonInfo(
+		LOCTEXT("CancelButton", "取消"),
+		LOCTEXT("CancelButtonTooltip", "在当前行处理完后停止导入，已生成的资产保留"),
+		FSimpleDelegate::CreateUObject(this, &UAbilityEditorAsyncImport::Cancel),
+		SNotificationItem::CS_Pending));
+
+	TSharedPtr<SNotificationItem> Item = FSlateNotificationManager::Get().AddNotification(Info);
+	if (Item.IsValid())
+	{
+		Item->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+	Notification = Item;
+#endif
+}
+
+void UAbilityEditorAsyncImport::UpdateNotification()
+{
+#if WITH_EDITOR
+	if (TSharedPtr<SNotificationItem> Item = Notification.Pin())
+	{
+		Item->SetText(FText::Format(LOCTEXT("Progress", "{0}：{1} / {2}"), Job->GetDisplayName(), FText::AsNumber(NumStepsDone), FText::AsNumber(NumSteps)));
+	}
+#endif
+}
+
+void UAbilityEditorAsyncImport::CloseNotification(bool bSuccess, bool bCancelled)
+{
+#if WITH_EDITOR
+	TSharedPtr<SNotificationItem> Item = Notification.Pin();
+	if (!Item.IsValid())
+	{
+		return;
+	}
+
+	FText Result;
+	if (bCancelled)
+	{
+		Result = FText::Format(LOCTEXT("Cancelled", "{0}：已取消（已处理 {1} / {2}）"), Job->GetDisplayName(), FText::AsNumber(NumStepsDone), FText::AsNumber(NumSteps));
+	}
+	else if (bSuccess)
+	{
+		Result = FText::Format(LOCTEXT("Succeeded", "{0}：完成"), Job->GetDisplayName());
+	}
+	else
+	{
+		Result = FText::Format(LOCTEXT("Failed", "{0}：失败，详见输出日志"), Job->GetDisplayName());
+	}
+
+	Item->SetText(Result);
+	Item->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+	Item->ExpireAndFadeout();
+	Notification.Reset();
+#endif
+}
+
+#undef LOCTEXT_NAMESPACE
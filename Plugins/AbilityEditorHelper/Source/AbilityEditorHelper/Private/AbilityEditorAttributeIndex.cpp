@@ -0,0 +1,157 @@
+// AbilityEditorAttributeIndex.cpp
+
+#include "AbilityEditorAttributeIndex.h"
+#include "AbilityEditorTypes.h"
+#include "Misc/ScopeRWLock.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectGlobals.h"
+
+FAbilityEditorAttributeIndex& FAbilityEditorAttributeIndex::Get()
+{
+	static FAbilityEditorAttributeIndex Instance;
+	return Instance;
+}
+
+bool FAbilityEditorAttributeIndex::Find(const FString& AttributeString, FGameplayAttribute& OutAttribute)
+{
+	EnsureBuilt();
+
+	FReadScopeLock ReadLock(Lock);
+	if (const FGameplayAttribute* Found = Attributes.Find(AttributeString.ToLower()))
+	{
+		OutAttribute = *Found;
+		return true;
+	}
+	return false;
+}
+
+bool FAbilityEditorAttributeIndex::Find(const FString& ClassName, const FString& PropertyName, FGameplayAttribute& OutAttribute)
+{
+	EnsureBuilt();
+
+	FReadScopeLock ReadLock(Lock);
+	if (const FGameplayAttribute* Found = FindByClassKeyLocked(ClassName.ToLower(), PropertyName.ToLower()))
+	{
+		OutAttribute = *Found;
+		return true;
+	}
+	return false;
+}
+
+bool FAbilityEditorAttributeIndex::HasAttributeSetClass(const FString& ClassName)
+{
+	EnsureBuilt();
+
+	FReadScopeLock ReadLock(Lock);
+	const FString LowerClassName = ClassName.ToLower();
+	return ClassNames.Contains(LowerClassName)
+		|| (!LowerClassName.StartsWith(TEXT("u")) && ClassNames.Contains(TEXT("u") + LowerClassName));
+}
+
+const FGameplayAttribute* FAbilityEditorAttributeIndex::FindByClassKeyLocked(const FString& LowerClassName, const FString& LowerPropertyName) const
+{
+	if (const FGameplayAttribute* Found = Attributes.Find(LowerClassName + TEXT(".") + LowerPropertyName))
+	{
+		return Found;
+	}
+
+	// 反射类名不带 U 前缀；与旧逻辑一致，也接受名称本身以 U 开头的类
+	if (!LowerClassName.StartsWith(TEXT("u")))
+	{
+		return Attributes.Find(TEXT("u") + LowerClassName + TEXT(".") + LowerPropertyName);
+	}
+	return nullptr;
+}
+
+void FAbilityEditorAttributeIndex::Invalidate()
+{
+	FWriteScopeLock WriteLock(Lock);
+	bBuilt = false;
+	Attributes.Reset();
+	ClassNames.Reset();
+}
+
+void FAbilityEditorAttributeIndex::EnsureBuilt()
+{
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (bBuilt)
+		{
+			return;
+		}
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+	if (bBuilt)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<UClass*> AttributeSetClasses;
+	GetDerivedClasses(UAttributeSet::StaticClass(), AttributeSetClasses, true);
+
+	for (UClass* Class : AttributeSetClasses)
+	{
+		if (!Class || Class->HasAnyClassFlags(CLASS_Abstract | CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+
+		const FString LowerClassName = Class->GetName().ToLower();
+		const FString LowerClassPath = Class->GetPathName().ToLower();
+		ClassNames.Add(LowerClassName);
+
+		for (TFieldIterator<FProperty> It(Class); It; ++It)
+		{
+			FProperty* Property = *It;
+			const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			if (!StructProperty || StructProperty->Struct != FGameplayAttributeData::StaticStruct())
+			{
+				continue;
+			}
+
+			const FGameplayAttribute Attribute(Property);
+			const FString LowerPropertyName = Property->GetName().ToLower();
+
+			// 同名类以先遍历到的为准（与逐个遍历时的 break 行为一致）
+			const FString ShortKey = LowerClassName + TEXT(".") + LowerPropertyName;
+			if (!Attributes.Contains(ShortKey))
+			{
+				Attributes.Add(ShortKey, Attribute);
+			}
+			Attributes.Add(LowerClassPath + TEXT(":") + LowerPropertyName, Attribute);
+		}
+	}
+
+	bBuilt = true;
+
+	UE_LOG(LogAbilityEditor, Verbose, TEXT("[AbilityEditorHelper] AttributeSet 属性索引已构建：%d 个类，%d 个键，耗时 %.2f 毫秒"),
+		ClassNames.Num(), Attributes.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FAbilityEditorAttributeIndex::RegisterInvalidationDelegates()
+{
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		Invalidate();
+	});
+
+	// 新加载的模块可能带来新的 AttributeSet 类
+	ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddLambda([this](FName, EModuleChangeReason Reason)
+	{
+		if (Reason == EModuleChangeReason::ModuleLoaded)
+		{
+			Invalidate();
+		}
+	});
+}
+
+void FAbilityEditorAttributeIndex::UnregisterInvalidationDelegates()
+{
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+	Invalidate();
+}
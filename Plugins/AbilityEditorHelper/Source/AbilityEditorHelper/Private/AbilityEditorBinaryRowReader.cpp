@@ -0,0 +1,301 @@
+// AbilityEditorBinaryRowReader.cpp
+
+#include "AbilityEditorBinaryRowReader.h"
+
+namespace
+{
+	constexpr uint8 BinaryRowsMagic[4] = { 'A', 'E', 'R', 'B' };
+	constexpr uint8 BinaryRowsVersion = 1;
+
+	/** Token 操作码（与 ability_editor_excel_tool.py 中的 _OP_* 一致） */
+	enum class EBinaryRowOp : uint8
+	{
+		ObjectStart = 0,
+		ObjectEnd = 1,
+		ArrayStart = 2,
+		ArrayEnd = 3,
+		Null = 4,
+		False = 5,
+		True = 6,
+		Integer = 7,
+		Float = 8,
+		String = 9,
+		TagContainer = 10,
+	};
+
+	constexpr uint8 BinaryRowOpHasKey = 0x80;
+}
+
+bool FAbilityEditorBinaryRowReader::IsBinaryRowFile(const FString& FilePath)
+{
+	return FilePath.EndsWith(GetFileExtension(), ESearchCase::IgnoreCase);
+}
+
+bool FAbilityEditorBinaryRowReader::OpenFile(const FString& InFilePath, const FString& ExpectedSchemaHash)
+{
+	FilePath = InFilePath;
+	FString OpenError;
+	if (!File.Open(FilePath, OpenError))
+	{
+		return SetError(OpenError);
+	}
+	Data = File.GetData();
+	DataSize = File.GetSize();
+
+	if (DataSize < 5 || FMemory::Memcmp(Data, BinaryRowsMagic, sizeof(BinaryRowsMagic)) != 0)
+	{
+		return SetError(FString::Printf(TEXT("不是二进制行文件：%s"), *FilePath));
+	}
+	if (Data[4] != BinaryRowsVersion)
+	{
+		return SetError(FString::Printf(TEXT("二进制行文件版本 %d 不受支持（当前为 %d），请重新导出：%s"), Data[4], BinaryRowsVersion, *FilePath));
+	}
+	Cursor = 5;
+
+	FString SchemaHash;
+	if (!ReadString(SchemaHash))
+	{
+		return false;
+	}
+	if (!SchemaHash.Equals(ExpectedSchemaHash, ESearchCase::IgnoreCase))
+	{
+		return SetError(FString::Printf(TEXT("%s 由旧版 Schema（%s）导出，与当前行结构（%s）不一致，请重新生成 Schema 并导出"),
+			*FilePath, *SchemaHash, *ExpectedSchemaHash));
+	}
+
+	uint64 StringCount = 0;
+	if (!ReadVarint(StringCount))
+	{
+		return false;
+	}
+	if (StringCount > static_cast<uint64>(DataSize))
+	{
+		return SetError(FString::Printf(TEXT("字符串表损坏：%s"), *FilePath));
+	}
+	Strings.SetNum(static_cast<int32>(StringCount));
+	for (FString& String : Strings)
+	{
+		if (!ReadString(String))
+		{
+			return false;
+		}
+	}
+
+	return ReadVarint(RemainingRows);
+}
+
+bool FAbilityEditorBinaryRowReader::ReadNextRow(FAbilityEditorJsonRow& OutRow)
+{
+	OutRow.Reset();
+	if (HasError() || RemainingRows == 0)
+	{
+		return false;
+	}
+	--RemainingRows;
+
+	uint64 RowSize = 0;
+	if (!ReadVarint(RowSize))
+	{
+		return false;
+	}
+	if (RowSize == 0 || RowSize > static_cast<uint64>(DataSize - Cursor))
+	{
+		return SetError(FString::Printf(TEXT("行数据越界（偏移 %lld）：%s"), Cursor, *FilePath));
+	}
+	const int64 RowEnd = Cursor + static_cast<int64>(RowSize);
+
+	if (!DecodeRow(RowEnd, OutRow))
+	{
+		return false;
+	}
+	Cursor = RowEnd;
+	return true;
+}
+
+bool FAbilityEditorBinaryRowReader::DecodeRow(int64 RowEnd, FAbilityEditorJsonRow& OutRow)
+{
+	if (static_cast<EBinaryRowOp>(Data[Cursor]) != EBinaryRowOp::ObjectStart)
+	{
+		return SetError(FString::Printf(TEXT("行不是对象（偏移 %lld）：%s"), Cursor, *FilePath));
+	}
+
+	FAbilityEditorJsonTokenWriter Writer(OutRow.Tokens);
+	int32 Depth = 0;
+	while (Cursor < RowEnd)
+	{
+		const uint8 OpCode = Data[Cursor++];
+
+		FString Key;
+		if (OpCode & BinaryRowOpHasKey)
+		{
+			int32 KeyIndex = 0;
+			if (!ReadIndex(KeyIndex))
+			{
+				return false;
+			}
+			Key = Strings[KeyIndex];
+		}
+
+		switch (static_cast<EBinaryRowOp>(OpCode & ~BinaryRowOpHasKey))
+		{
+		case EBinaryRowOp::ObjectStart:
+			Writer.BeginObject(Key);
+			++Depth;
+			continue;
+		case EBinaryRowOp::ArrayStart:
+			Writer.BeginArray(Key);
+			++Depth;
+			continue;
+		case EBinaryRowOp::ObjectEnd:
+			Writer.EndObject();
+			--Depth;
+			break;
+		case EBinaryRowOp::ArrayEnd:
+			Writer.EndArray();
+			--Depth;
+			break;
+		case EBinaryRowOp::Null:
+			Writer.Null(Key);
+			break;
+		case EBinaryRowOp::False:
+		case EBinaryRowOp::True:
+			Writer.Boolean(Key, static_cast<EBinaryRowOp>(OpCode & ~BinaryRowOpHasKey) == EBinaryRowOp::True);
+			break;
+		case EBinaryRowOp::Integer:
+			{
+				uint64 ZigZag = 0;
+				if (!ReadVarint(ZigZag))
+				{
+					return false;
+				}
+				Writer.Integer(Key, static_cast<int64>(ZigZag >> 1) ^ -static_cast<int64>(ZigZag & 1));
+			}
+			break;
+		case EBinaryRowOp::Float:
+			{
+				double Value = 0.0;
+				if (Cursor + static_cast<int64>(sizeof(Value)) > RowEnd)
+				{
+					return SetError(FString::Printf(TEXT("浮点数越界（偏移 %lld）：%s"), Cursor, *FilePath));
+				}
+				FMemory::Memcpy(&Value, Data + Cursor, sizeof(Value));
+				Cursor += sizeof(Value);
+				Writer.Float(Key, Value);
+			}
+			break;
+		case EBinaryRowOp::String:
+			{
+				int32 StringIndex = 0;
+				if (!ReadIndex(StringIndex))
+				{
+					return false;
+				}
+				Writer.String(Key, Strings[StringIndex]);
+			}
+			break;
+		case EBinaryRowOp::TagContainer:
+			{
+				uint64 TagCount = 0;
+				if (!ReadVarint(TagCount) || TagCount > static_cast<uint64>(RowEnd - Cursor))
+				{
+					return SetError(FString::Printf(TEXT("TagContainer 损坏（偏移 %lld）：%s"), Cursor, *FilePath));
+				}
+				TArray<FString> Tags;
+				Tags.Reserve(static_cast<int32>(TagCount));
+				for (uint64 TagIndex = 0; TagIndex < TagCount; ++TagIndex)
+				{
+					int32 StringIndex = 0;
+					if (!ReadIndex(StringIndex))
+					{
+						return false;
+					}
+					Tags.Add(Strings[StringIndex]);
+				}
+				Writer.TagContainer(Key, Tags);
+			}
+			break;
+		default:
+			return SetError(FString::Printf(TEXT("未知的操作码 %d（偏移 %lld）：%s"), OpCode, Cursor - 1, *FilePath));
+		}
+
+		if (Depth == 0)
+		{
+			break;
+		}
+		if (Depth < 0)
+		{
+			return SetError(FString::Printf(TEXT("对象/数组嵌套不匹配（偏移 %lld）：%s"), Cursor, *FilePath));
+		}
+
+		// 行名只取顶层 Name 字段（与 JSON 读取一致：数字也视为字符串）
+		const FAbilityEditorJsonToken& Token = OutRow.Tokens.Last();
+		if (Depth == 1 && Token.Identifier == TEXT("Name") && (Token.Notation == EJsonNotation::String || Token.Notation == EJsonNotation::Number))
+		{
+			OutRow.Name = Token.Value;
+		}
+	}
+
+	if (Depth != 0 || Cursor != RowEnd)
+	{
+		return SetError(FString::Printf(TEXT("行数据不完整（偏移 %lld）：%s"), Cursor, *FilePath));
+	}
+	return true;
+}
+
+bool FAbilityEditorBinaryRowReader::ReadVarint(uint64& OutValue)
+{
+	OutValue = 0;
+	for (int32 Shift = 0; Shift < 64; Shift += 7)
+	{
+		if (Cursor >= DataSize)
+		{
+			return SetError(FString::Printf(TEXT("文件意外结束：%s"), *FilePath));
+		}
+		const uint8 Byte = Data[Cursor++];
+		OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+		if (!(Byte & 0x80))
+		{
+			return true;
+		}
+	}
+	return SetError(FString::Printf(TEXT("变长整数损坏（偏移 %lld）：%s"), Cursor, *FilePath));
+}
+
+bool FAbilityEditorBinaryRowReader::ReadIndex(int32& OutIndex)
+{
+	uint64 Index = 0;
+	if (!ReadVarint(Index))
+	{
+		return false;
+	}
+	if (Index >= static_cast<uint64>(Strings.Num()))
+	{
+		return SetError(FString::Printf(TEXT("字符串索引 %llu 越界（偏移 %lld）：%s"), Index, Cursor, *FilePath));
+	}
+	OutIndex = static_cast<int32>(Index);
+	return true;
+}
+
+bool FAbilityEditorBinaryRowReader::ReadString(FString& OutString)
+{
+	uint64 ByteCount = 0;
+	if (!ReadVarint(ByteCount))
+	{
+		return false;
+	}
+	if (ByteCount > static_cast<uint64>(DataSize - Cursor))
+	{
+		return SetError(FString::Printf(TEXT("字符串越界（偏移 %lld）：%s"), Cursor, *FilePath));
+	}
+
+	const auto Converted = StringCast<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Data + Cursor), static_cast<int32>(ByteCount));
+	OutString = FString(Converted.Length(), Converted.Get());
+	Cursor += static_cast<int64>(ByteCount);
+	return true;
+}
+
+bool FAbilityEditorBinaryRowReader::SetError(const FString& InMessage)
+{
+	ErrorMessage = InMessage;
+	return false;
+}
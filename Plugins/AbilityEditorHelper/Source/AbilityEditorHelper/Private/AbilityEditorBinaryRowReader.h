@@ -0,0 +1,55 @@
+// AbilityEditorBinaryRowReader.h
+// 紧凑二进制行文件（.aebin）读取：Python 导出工具的可选输出，与 JSON 对象数组等价但更小、解码更快
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilityEditorJsonRowReader.h"
+#include "AbilityEditorMappedFile.h"
+
+/**
+ * 二进制行文件格式（变长整数为 LEB128，字符串为 变长字节数 + UTF-8）：
+ * - 文件头：    "AERB" | 版本（1 字节） | 行结构的 Schema Hash（字符串，同 FExcelSchema::Hash）
+ * - 字符串表：  数量 | 各字符串（键名与字符串值都只在这里出现一次）
+ * - 行：        行数 | 各行：字节数 + Token 序列（以 ObjectStart 开始、对应的 ObjectEnd 结束）
+ * Token 为 1 字节操作码（最高位为 1 时其后紧跟键名的字符串表索引）加上值：
+ *   0 ObjectStart  1 ObjectEnd  2 ArrayStart  3 ArrayEnd  4 Null  5 false  6 true
+ *   7 整数（ZigZag 变长整数）  8 浮点数（小端 double）  9 字符串（字符串表索引）
+ *   10 GameplayTagContainer（Tag 数量 + 各 Tag 的字符串表索引；ParentTags 由读取端还原）
+ * 读取端把每行还原为与 JSON 行对象相同的 Token 序列，源数据哈希、增量比较与 JSON 导入完全一致
+ * 写入端见 ability_editor_excel_tool.py 的 _write_binary_rows
+ */
+class FAbilityEditorBinaryRowReader : public FAbilityEditorRowSource
+{
+public:
+	/** 文件扩展名（含 .） */
+	static const TCHAR* GetFileExtension() { return TEXT(".aebin"); }
+
+	static bool IsBinaryRowFile(const FString& FilePath);
+
+	/**
+	 * 映射文件并校验文件头、读取字符串表（行数据在 ReadNextRow 时直接从映射的字节解码）
+	 * @param ExpectedSchemaHash  当前行结构的 Schema Hash；与文件记录的不一致时拒绝读取（结构体已变化，需要重新导出）
+	 */
+	bool OpenFile(const FString& FilePath, const FString& ExpectedSchemaHash);
+
+	virtual bool ReadNextRow(FAbilityEditorJsonRow& OutRow) override;
+
+private:
+	bool ReadVarint(uint64& OutValue);
+	bool ReadIndex(int32& OutIndex);
+	bool ReadString(FString& OutString);
+
+	/** 解码一行的 Token 序列（到 RowEnd 为止） */
+	bool DecodeRow(int64 RowEnd, FAbilityEditorJsonRow& OutRow);
+
+	bool SetError(const FString& InMessage);
+
+	FString FilePath;
+	FAbilityEditorMappedFile File;
+	const uint8* Data = nullptr;
+	int64 DataSize = 0;
+	int64 Cursor = 0;
+	TArray<FString> Strings;
+	uint64 RemainingRows = 0;
+};
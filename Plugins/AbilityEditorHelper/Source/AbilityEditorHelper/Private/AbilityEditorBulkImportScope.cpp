@@ -0,0 +1,262 @@
+// AbilityEditorBulkImportScope.cpp
+
+#include "AbilityEditorBulkImportScope.h"
+#include "AbilityEditorTypes.h"
+#include "AbilityEditorHelperSettings.h"
+#include "AbilityEditorAssetPathCache.h"
+#include "CoreGlobals.h"
+#include "UObject/Package.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "FileHelpers.h"
+#include "ISourceControlModule.h"
+#include "Misc/PackageName.h"
+#include "UObject/SavePackage.h"
+#endif
+
+FAbilityEditorBulkImportScope* FAbilityEditorBulkImportScope::RootScope = nullptr;
+
+FAbilityEditorBulkImportScope::FAbilityEditorBulkImportScope()
+{
+	check(IsInGameThread());
+	if (RootScope)
+	{
+		return;
+	}
+	RootScope = this;
+
+	// 路径解析缓存以最外层作用域为一个导入会话
+	FAbilityEditorAssetPathCache::Get().Reset();
+
+	// 停止记录撤销：NewObject/Modify 只在 GUndo 有效时写入事务
+	const UAbilityEditorHelperSettings* Settings = GetDefault<UAbilityEditorHelperSettings>();
+	const EAbilityEditorBulkUndoMode UndoMode = Settings ? Settings->BulkImportUndoMode : EAbilityEditorBulkUndoMode::Record;
+	if (UndoMode != EAbilityEditorBulkUndoMode::Record)
+	{
+		SavedUndo = GUndo;
+		GUndo = nullptr;
+		bSuppressingUndo = true;
+		bResetUndoBufferOnExit = (UndoMode == EAbilityEditorBulkUndoMode::SuppressAndResetBuffer);
+	}
+}
+
+FAbilityEditorBulkImportScope::~FAbilityEditorBulkImportScope()
+{
+	if (!IsRootScope())
+	{
+		return;
+	}
+
+	Flush();
+
+	if (bSuppressingUndo)
+	{
+		GUndo = SavedUndo;
+	}
+
+#if WITH_EDITOR
+	if (bResetUndoBufferOnExit && GEditor)
+	{
+		GEditor->ResetTransaction(NSLOCTEXT("AbilityEditorHelper", "BulkImportResetUndo", "AbilityEditorHelper 批量导入"));
+	}
+#endif
+
+	FAbilityEditorAssetPathCache::Get().Reset();
+	RootScope = nullptr;
+}
+
+void FAbilityEditorBulkImportScope::AssetCreated(UObject* Asset)
+{
+	if (!Asset)
+	{
+		return;
+	}
+
+	if (RootScope)
+	{
+		// 资产注册表通知被延迟，先让该路径此前的加载失败记录失效
+		FAbilityEditorAssetPathCache::Get().InvalidatePackage(Asset->GetPackage()->GetFName());
+		RootScope->PendingCreatedAssets.Add(Asset);
+		MarkPackageDirty(Asset);
+		return;
+	}
+
+#if WITH_EDITOR
+	FAssetRegistryModule::AssetCreated(Asset);
+#endif
+	Asset->MarkPackageDirty();
+}
+
+void FAbilityEditorBulkImportScope::MarkPackageDirty(UObject* Object)
+{
+	if (!Object)
+	{
+		return;
+	}
+
+	if (RootScope)
+	{
+		UPackage* Package = Object->GetPackage();
+		bool bAlreadyPending = false;
+		RootScope->PendingDirtyPackageSet.Add(Package, &bAlreadyPending);
+		if (!bAlreadyPending)
+		{
+			RootScope->PendingDirtyPackages.Add(Package);
+		}
+		return;
+	}
+
+	Object->MarkPackageDirty();
+}
+
+TArray<UPackage*> FAbilityEditorBulkImportScope::GetTouchedPackages() const
+{
+	TArray<UPackage*> Result;
+	Result.Reserve(TouchedPackages.Num() + PendingDirtyPackages.Num());
+	for (const TWeakObjectPtr<UPackage>& Package : TouchedPackages)
+	{
+		if (Package.IsValid())
+		{
+			Result.Add(Package.Get());
+		}
+	}
+	for (const TWeakObjectPtr<UPackage>& Package : PendingDirtyPackages)
+	{
+		if (Package.IsValid() && !TouchedPackageSet.Contains(Package))
+		{
+			Result.Add(Package.Get());
+		}
+	}
+	return Result;
+}
+
+void FAbilityEditorBulkImportScope::Flush()
+{
+	// 嵌套作用域的刷新请求转交给最外层作用域
+	if (!IsRootScope())
+	{
+		if (RootScope)
+		{
+			RootScope->Flush();
+		}
+		return;
+	}
+
+	if (PendingCreatedAssets.Num() == 0 && PendingDirtyPackages.Num() == 0)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 CreatedCount = PendingCreatedAssets.Num();
+	const int32 DirtyCount = PendingDirtyPackages.Num();
+
+#if WITH_EDITOR
+	// 资产注册表：新建资产统一通知一次
+	for (const TWeakObjectPtr<UObject>& Asset : PendingCreatedAssets)
+	{
+		if (Asset.IsValid())
+		{
+			FAssetRegistryModule::AssetCreated(Asset.Get());
+		}
+	}
+#endif
+
+	// 脏包：每个包只标记一次
+	for (const TWeakObjectPtr<UPackage>& Package : PendingDirtyPackages)
+	{
+		if (Package.IsValid())
+		{
+			Package->MarkPackageDirty();
+
+			bool bAlreadyTouched = false;
+			TouchedPackageSet.Add(Package, &bAlreadyTouched);
+			if (!bAlreadyTouched)
+			{
+				TouchedPackages.Add(Package);
+			}
+		}
+	}
+
+	PendingCreatedAssets.Reset();
+	PendingDirtyPackages.Reset();
+	PendingDirtyPackageSet.Reset();
+
+	UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 批量导入通知已刷新：新建资产 %d 个，脏包 %d 个，耗时 %.2f 秒"),
+		CreatedCount, DirtyCount, FPlatformTime::Seconds() - StartTime);
+}
+
+bool FAbilityEditorBulkImportScope::SaveTouchedPackages()
+{
+	if (!IsRootScope())
+	{
+		return false;
+	}
+
+	Flush();
+
+#if WITH_EDITOR
+	TArray<UPackage*> PackagesToSave;
+	for (UPackage* Package : GetTouchedPackages())
+	{
+		if (Package && Package->IsDirty())
+		{
+			PackagesToSave.Add(Package);
+		}
+	}
+	if (PackagesToSave.Num() == 0)
+	{
+		return true;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// 启用源码管理时静默签出（不弹出签出对话框）；未能签出的只读文件会在保存时失败并计入失败
+	if (ISourceControlModule::Get().IsEnabled())
+	{
+		FEditorFileUtils::CheckoutPackages(PackagesToSave, nullptr, /*bErrorIfAlreadyCheckedOut*/ false);
+	}
+
+	// 一次性提交所有包的保存，文件异步写入
+	int32 SavedCount = 0;
+	int32 FailedCount = 0;
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_Async | SAVE_NoError;
+
+	for (UPackage* Package : PackagesToSave)
+	{
+		const FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		const double PackageStartTime = FPlatformTime::Seconds();
+		const FSavePackageResultStruct Result = UPackage::Save(Package, Package->FindAssetInPackage(), *PackageFileName, SaveArgs);
+		const double PackageSeconds = FPlatformTime::Seconds() - PackageStartTime;
+
+		if (Result.IsSuccessful())
+		{
+			++SavedCount;
+			UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 已保存包 %s（%.1f 毫秒）"), *Package->GetName(), PackageSeconds * 1000.0);
+		}
+		else
+		{
+			++FailedCount;
+			UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 保存包失败：%s（%.1f 毫秒）"), *Package->GetName(), PackageSeconds * 1000.0);
+		}
+	}
+
+	// 等待所有异步写文件完成
+	const double WaitStartTime = FPlatformTime::Seconds();
+	UPackage::WaitForAsyncFileWrites();
+	const double WaitSeconds = FPlatformTime::Seconds() - WaitStartTime;
+
+	const bool bSucceeded = FailedCount == 0;
+	UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 批量保存%s：成功 %d 个，失败 %d 个，总耗时 %.2f 秒（等待异步写入 %.2f 秒）"),
+		bSucceeded ? TEXT("完成") : TEXT("未全部完成"), SavedCount, FailedCount, FPlatformTime::Seconds() - StartTime, WaitSeconds);
+
+	return bSucceeded;
+#else
+	return false;
+#endif
+}
@@ -1,6 +1,11 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AbilityEditorHelper.h"
+#include "AbilityEditorAssetPathCache.h"
+#include "AbilityEditorAssetStamp.h"
+#include "AbilityEditorAttributeIndex.h"
+#include "AbilityEditorPropertyHandles.h"
+#include "AbilityEditorRowAssetType.h"
 
 #if WITH_EDITOR
 #include "ToolMenus.h"
@@ -14,6 +19,19 @@
 
 void FAbilityEditorHelperModule::StartupModule()
 {
+	// 热重载、模块加载与资产重命名/删除时使路径解析缓存与属性索引失效
+	FAbilityEditorAssetPathCache::Get().RegisterInvalidationDelegates();
+	FAbilityEditorAttributeIndex::Get().RegisterInvalidationDelegates();
+
+	// 一次性解析 GE/GA 导入写入的反射属性，无法解析的在此统一报告
+	FAbilityEditorPropertyHandles::Initialize();
+
+	// 生成资产的配置印记随资产注册表标签保存，未加载的资产也能直接比较
+	FAbilityEditorAssetStamp::RegisterAssetRegistryTag();
+
+	// 内置行类型 GameplayEffect / GameplayAbility；项目模块可在此之后注册自己的行类型
+	FAbilityEditorRowAssetTypeRegistry::RegisterBuiltInTypes();
+
 #if WITH_EDITOR
 	// 延迟注册菜单，确保 UToolMenus 已初始化
 	UToolMenus::RegisterStartupCallback(
@@ -27,6 +45,11 @@ void FAbilityEditorHelperModule::StartupModule()
 
 void FAbilityEditorHelperModule::ShutdownModule()
 {
+	FAbilityEditorAssetPathCache::Get().UnregisterInvalidationDelegates();
+	FAbilityEditorAttributeIndex::Get().UnregisterInvalidationDelegates();
+	FAbilityEditorAssetStamp::UnregisterAssetRegistryTag();
+	FAbilityEditorRowAssetTypeRegistry::UnregisterBuiltInTypes();
+
 #if WITH_EDITOR
 	UToolMenus::UnRegisterStartupCallback(this);
 	UToolMenus::UnregisterOwner(this);
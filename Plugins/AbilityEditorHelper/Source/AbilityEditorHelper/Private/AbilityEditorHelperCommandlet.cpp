@@ -0,0 +1,401 @@
+// AbilityEditorHelperCommandlet.cpp
+
+#include "AbilityEditorHelperCommandlet.h"
+#include "AbilityEditorHelperLibrary.h"
+#include "AbilityEditorBulkImportScope.h"
+#include "AbilityEditorRowShard.h"
+#include "AbilityEditorSpreadsheetReader.h"
+#include "AbilityEditorTypes.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** 单个分片工作进程 */
+	struct FShardWorker
+	{
+		FProcHandle Handle;
+		FString LogFile;
+		FString ReportFile;
+		bool bRunning = false;
+		FAbilityEditorShardReport Report;
+	};
+
+	const TCHAR* GetTargetName(EAbilityEditorGenerationTarget Target)
+	{
+		return Target == EAbilityEditorGenerationTarget::GameplayAbility ? TEXT("GA") : TEXT("GE");
+	}
+
+	FString GetReportDir()
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AbilityEditorHelper"), TEXT("Reports")));
+	}
+
+	template<typename StructType>
+	bool SaveReport(const StructType& Report, const FString& FilePath)
+	{
+		FString JsonString;
+		if (!FJsonObjectConverter::UStructToJsonObjectString(Report, JsonString)
+			|| !FFileHelper::SaveStringToFile(JsonString, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 无法写入报告：%s"), *FilePath);
+			return false;
+		}
+		return true;
+	}
+
+	/** 把工作进程日志中的警告与错误转发到本进程日志，并统计数量 */
+	void MergeWorkerLog(FShardWorker& Worker)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *Worker.LogFile))
+		{
+			UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] [分片 %d] 无法读取日志：%s"), Worker.Report.ShardIndex, *Worker.LogFile);
+			return;
+		}
+
+		for (const FString& Line : Lines)
+		{
+			if (Line.Contains(TEXT("Error: ")))
+			{
+				++Worker.Report.ErrorCount;
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] [分片 %d] %s"), Worker.Report.ShardIndex, *Line);
+			}
+			else if (Line.Contains(TEXT("Warning: ")))
+			{
+				++Worker.Report.WarningCount;
+				UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] [分片 %d] %s"), Worker.Report.ShardIndex, *Line);
+			}
+		}
+	}
+
+	/**
+	 * 协调模式：启动 ShardCount 个工作进程并行生成 Target，等待全部结束后合并日志与报告
+	 * 全部分片成功后由本进程记录输入指纹（工作进程不写清单，避免并发写同一文件）
+	 */
+	bool RunShardedGeneration(EAbilityEditorGenerationTarget Target, int32 ShardCount, bool bClear, bool bForce)
+	{
+		const TCHAR* TargetName = GetTargetName(Target);
+		if (!bForce && UAbilityEditorHelperLibrary::IsBatchGenerationUpToDate(Target, bClear))
+		{
+			UE_LOG(LogAbilityEditor, Display, TEXT("[AbilityEditorHelper] 输入指纹未变化，%s 无需生成（可使用 -Force 强制生成）"), TargetName);
+			return true;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		const FString ReportDir = GetReportDir();
+		IFileManager::Get().MakeDirectory(*ReportDir, true);
+
+		const FString ExecutablePath = FPlatformProcess::ExecutablePath();
+		const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+
+		TArray<FShardWorker> Workers;
+		Workers.SetNum(ShardCount);
+		int32 RunningCount = 0;
+		bool bLaunchFailed = false;
+
+		for (int32 ShardIndex = 0; ShardIndex < ShardCount; ++ShardIndex)
+		{
+			FShardWorker& Worker = Workers[ShardIndex];
+			Worker.Report.ShardIndex = ShardIndex;
+			Worker.Report.ShardCount = ShardCount;
+			Worker.LogFile = ReportDir / FString::Printf(TEXT("%s_Shard%d.log"), TargetName, ShardIndex);
+			Worker.ReportFile = ReportDir / FString::Printf(TEXT("%s_Shard%d.json"), TargetName, ShardIndex);
+			Worker.Report.LogFile = Worker.LogFile;
+			IFileManager::Get().Delete(*Worker.ReportFile, false, true, true);
+
+			const FString WorkerParams = FString::Printf(
+				TEXT("\"%s\" -run=AbilityEditorHelper -Generate%s -ShardCount=%d -ShardIndex=%d -ShardReport=\"%s\" -abslog=\"%s\"%s -unattended -nullrhi -nosplash -nopause"),
+				*ProjectPath, TargetName, ShardCount, ShardIndex, *Worker.ReportFile, *Worker.LogFile, bClear ? TEXT(" -Clear") : TEXT(""));
+
+			Worker.Handle = FPlatformProcess::CreateProc(*ExecutablePath, *WorkerParams, false, true, true, nullptr, 0, nullptr, nullptr);
+			if (!Worker.Handle.IsValid())
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 无法启动 %s 分片 %d 的工作进程：%s %s"), TargetName, ShardIndex, *ExecutablePath, *WorkerParams);
+				bLaunchFailed = true;
+				continue;
+			}
+
+			Worker.bRunning = true;
+			++RunningCount;
+		}
+
+		UE_LOG(LogAbilityEditor, Display, TEXT("[AbilityEditorHelper] 已启动 %d 个 %s 工作进程，日志与报告目录：%s"), RunningCount, TargetName, *ReportDir);
+
+		while (RunningCount > 0)
+		{
+			FPlatformProcess::Sleep(0.5f);
+
+			for (FShardWorker& Worker : Workers)
+			{
+				if (!Worker.bRunning || FPlatformProcess::IsProcRunning(Worker.Handle))
+				{
+					continue;
+				}
+
+				FPlatformProcess::GetProcReturnCode(Worker.Handle, &Worker.Report.ExitCode);
+				FPlatformProcess::CloseProc(Worker.Handle);
+				Worker.bRunning = false;
+				--RunningCount;
+
+				UE_LOG(LogAbilityEditor, Display, TEXT("[AbilityEditorHelper] %s 分片 %d 已结束（退出码 %d），剩余 %d 个"),
+					TargetName, Worker.Report.ShardIndex, Worker.Report.ExitCode, RunningCount);
+			}
+		}
+
+		// 合并各分片的报告与日志
+		FAbilityEditorShardedRunReport RunReport;
+		RunReport.Target = TargetName;
+		RunReport.ShardCount = ShardCount;
+		RunReport.bSuccess = !bLaunchFailed;
+
+		for (FShardWorker& Worker : Workers)
+		{
+			FString JsonString;
+			FAbilityEditorShardReport WorkerReport;
+			if (FFileHelper::LoadFileToString(JsonString, *Worker.ReportFile)
+				&& FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &WorkerReport, 0, 0))
+			{
+				Worker.Report.bSuccess = WorkerReport.bSuccess;
+				Worker.Report.Seconds = WorkerReport.Seconds;
+				Worker.Report.Steps = MoveTemp(WorkerReport.Steps);
+			}
+
+			MergeWorkerLog(Worker);
+
+			const bool bShardSucceeded = Worker.Report.ExitCode == 0 && Worker.Report.bSuccess;
+			if (!bShardSucceeded)
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] %s 分片 %d 失败（退出码 %d），详见日志：%s"),
+					TargetName, Worker.Report.ShardIndex, Worker.Report.ExitCode, *Worker.LogFile);
+			}
+			RunReport.bSuccess &= bShardSucceeded;
+			RunReport.Shards.Add(MoveTemp(Worker.Report));
+		}
+
+		RunReport.Seconds = FPlatformTime::Seconds() - StartTime;
+		SaveReport(RunReport, ReportDir / FString::Printf(TEXT("%s_Sharded.json"), TargetName));
+
+		if (RunReport.bSuccess)
+		{
+			UAbilityEditorHelperLibrary::SaveBatchGenerationFingerprint(Target, bClear);
+		}
+
+		UE_LOG(LogAbilityEditor, Display, TEXT("[AbilityEditorHelper] %s 分片生成%s：%d 个分片，耗时 %.2f 秒"),
+			TargetName, RunReport.bSuccess ? TEXT("完成") : TEXT("失败"), ShardCount, RunReport.Seconds);
+		return RunReport.bSuccess;
+	}
+}
+
+UAbilityEditorHelperCommandlet::UAbilityEditorHelperCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UAbilityEditorHelperCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	const bool bExportSchemas = Switches.Contains(TEXT("Schemas"));
+	const bool bClearSchemas = Switches.Contains(TEXT("ClearSchemas"));
+	const bool bGenerateGE = Switches.Contains(TEXT("GenerateGE"));
+	const bool bGenerateGA = Switches.Contains(TEXT("GenerateGA"));
+	const bool bClear = Switches.Contains(TEXT("Clear"));
+	const bool bForce = Switches.Contains(TEXT("Force"));
+	const bool bSave = !Switches.Contains(TEXT("NoSave"));
+	const FString* ImportGEFile = ParamValues.Find(TEXT("ImportGE"));
+	const FString* ImportGAFile = ParamValues.Find(TEXT("ImportGA"));
+
+	if (!bExportSchemas && !bGenerateGE && !bGenerateGA && !ImportGEFile && !ImportGAFile)
+	{
+		UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 未指定任何步骤。用法：-run=AbilityEditorHelper [-Schemas] [-ImportGE=<文件名>] [-ImportGA=<文件名>] [-GenerateGE] [-GenerateGA] [-Clear] [-Force] [-NoSave] [-Shards=<N>]"));
+		return 1;
+	}
+
+	// 工作进程：只生成自己分片的行
+	const FString* ShardCountValue = ParamValues.Find(TEXT("ShardCount"));
+	const bool bShardWorker = ShardCountValue != nullptr;
+	FString ShardReportFile;
+	if (bShardWorker)
+	{
+		const FString* ShardIndexValue = ParamValues.Find(TEXT("ShardIndex"));
+		const int32 ShardIndex = ShardIndexValue ? FCString::Atoi(**ShardIndexValue) : -1;
+		if (!FAbilityEditorRowShard::SetCurrent(FCString::Atoi(**ShardCountValue), ShardIndex))
+		{
+			UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 分片参数无效：-ShardCount=%s -ShardIndex=%s"), **ShardCountValue, ShardIndexValue ? **ShardIndexValue : TEXT(""));
+			return 1;
+		}
+		if (bExportSchemas || ImportGEFile || ImportGAFile)
+		{
+			UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 分片工作进程只执行 GE/GA 生成，不能导出 Schema 或导入数据"));
+			return 1;
+		}
+		if (const FString* ReportValue = ParamValues.Find(TEXT("ShardReport")))
+		{
+			ShardReportFile = ReportValue->TrimQuotes();
+		}
+	}
+
+	// 协调进程：生成步骤拆分给工作进程
+	const FString* ShardsValue = ParamValues.Find(TEXT("Shards"));
+	const int32 ShardCount = (ShardsValue && !bShardWorker) ? FCString::Atoi(**ShardsValue) : 1;
+	const bool bCoordinator = ShardCount > 1;
+	if (bCoordinator && !bSave)
+	{
+		UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] -Shards 不能与 -NoSave 同时使用：工作进程读取的是已保存的 DataTable，且生成结果由工作进程直接保存"));
+		return 1;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	bool bSuccess = true;
+	TArray<FAbilityEditorCommandletStepReport> StepReports;
+
+	// 按顺序执行步骤，任一失败即停止
+	auto RunStep = [&bSuccess, &StepReports](const TCHAR* StepName, TFunctionRef<bool()> Step)
+	{
+		if (!bSuccess)
+		{
+			return;
+		}
+
+		const double StepStartTime = FPlatformTime::Seconds();
+		UE_LOG(LogAbilityEditor, Display, TEXT("[AbilityEditorHelper] 开始：%s"), StepName);
+		bSuccess = Step();
+
+		FAbilityEditorCommandletStepReport& StepReport = StepReports.AddDefaulted_GetRef();
+		StepReport.Name = StepName;
+		StepReport.bSuccess = bSuccess;
+		StepReport.Seconds = FPlatformTime::Seconds() - StepStartTime;
+		UE_LOG(LogAbilityEditor, Display, TEXT("[AbilityEditorHelper] %s：%s（%.2f 秒）"), bSuccess ? TEXT("完成") : TEXT("失败"), StepName, StepReport.Seconds);
+	};
+
+	{
+		// 所有步骤共用一个批量导入作用域，结束时一次性保存
+		FAbilityEditorBulkImportScope BulkImportScope;
+
+		if (bExportSchemas)
+		{
+			RunStep(TEXT("导出 Schema"), [bClearSchemas]()
+			{
+				int32 SuccessCount = 0;
+				int32 FailureCount = 0;
+				FString Errors;
+				const bool bOK = UAbilityEditorHelperLibrary::GenerateAllSchemasFromSettings(bClearSchemas, SuccessCount, FailureCount, Errors);
+				if (!bOK)
+				{
+					UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] Schema 导出失败：\n%s"), *Errors);
+				}
+				return bOK;
+			});
+		}
+
+		if (ImportGEFile)
+		{
+			RunStep(TEXT("导入 GE 数据"), [ImportGEFile, bClear]()
+			{
+				TArray<FName> UpdatedRowNames;
+				return FAbilityEditorSpreadsheetRowReader::IsSpreadsheetFile(*ImportGEFile)
+					? UAbilityEditorHelperLibrary::ImportAndUpdateGameplayEffectsFromExcel(*ImportGEFile, bClear, UpdatedRowNames)
+					: UAbilityEditorHelperLibrary::ImportAndUpdateGameplayEffectsFromJson(*ImportGEFile, bClear, UpdatedRowNames);
+			});
+		}
+
+		if (ImportGAFile)
+		{
+			RunStep(TEXT("导入 GA 数据"), [ImportGAFile, bClear]()
+			{
+				TArray<FName> UpdatedRowNames;
+				return FAbilityEditorSpreadsheetRowReader::IsSpreadsheetFile(*ImportGAFile)
+					? UAbilityEditorHelperLibrary::ImportAndUpdateGameplayAbilitiesFromExcel(*ImportGAFile, bClear, UpdatedRowNames)
+					: UAbilityEditorHelperLibrary::ImportAndUpdateGameplayAbilitiesFromJson(*ImportGAFile, bClear, UpdatedRowNames);
+			});
+		}
+
+		if (bCoordinator)
+		{
+			// 先保存导入结果，工作进程从磁盘加载 DataTable
+			RunStep(TEXT("保存包"), [&BulkImportScope]()
+			{
+				return BulkImportScope.SaveTouchedPackages();
+			});
+
+			// GA 可能引用 GE（Cost / Cooldown 等），GE 全部分片完成后再生成 GA
+			if (bGenerateGE)
+			{
+				RunStep(TEXT("分片生成 GE"), [ShardCount, bClear, bForce]()
+				{
+					return RunShardedGeneration(EAbilityEditorGenerationTarget::GameplayEffect, ShardCount, bClear, bForce);
+				});
+			}
+
+			if (bGenerateGA)
+			{
+				RunStep(TEXT("分片生成 GA"), [ShardCount, bClear, bForce]()
+				{
+					return RunShardedGeneration(EAbilityEditorGenerationTarget::GameplayAbility, ShardCount, bClear, bForce);
+				});
+			}
+		}
+		else
+		{
+			if (bGenerateGE && bGenerateGA)
+			{
+				// 同时生成时按依赖顺序一次完成，GE/GA 之间的引用从内存中解析
+				RunStep(TEXT("生成 GE + GA"), [bClear, bForce]()
+				{
+					return UAbilityEditorHelperLibrary::CreateOrUpdateGameplayEffectsAndAbilitiesFromSettings(bClear, bForce);
+				});
+			}
+			else if (bGenerateGE)
+			{
+				RunStep(TEXT("生成 GE"), [bClear, bForce]()
+				{
+					return UAbilityEditorHelperLibrary::CreateOrUpdateGameplayEffectsFromSettings(bClear, bForce);
+				});
+			}
+			else if (bGenerateGA)
+			{
+				RunStep(TEXT("生成 GA"), [bClear, bForce]()
+				{
+					return UAbilityEditorHelperLibrary::CreateOrUpdateGameplayAbilitiesFromSettings(bClear, bForce);
+				});
+			}
+
+			if (bSave)
+			{
+				RunStep(TEXT("保存包"), [&BulkImportScope]()
+				{
+					return BulkImportScope.SaveTouchedPackages();
+				});
+			}
+		}
+	}
+
+	const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	if (!ShardReportFile.IsEmpty())
+	{
+		const FAbilityEditorRowShard& Shard = FAbilityEditorRowShard::GetCurrent();
+		FAbilityEditorShardReport Report;
+		Report.ShardIndex = Shard.Index;
+		Report.ShardCount = Shard.Count;
+		Report.bSuccess = bSuccess;
+		Report.Seconds = TotalSeconds;
+		Report.ExitCode = bSuccess ? 0 : 1;
+		Report.Steps = MoveTemp(StepReports);
+		SaveReport(Report, ShardReportFile);
+	}
+
+	UE_LOG(LogAbilityEditor, Display, TEXT("[AbilityEditorHelper] 命令行%s，总耗时 %.2f 秒"), bSuccess ? TEXT("执行成功") : TEXT("执行失败"), TotalSeconds);
+	return bSuccess ? 0 : 1;
+}
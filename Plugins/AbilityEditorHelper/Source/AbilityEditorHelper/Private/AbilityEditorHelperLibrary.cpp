@@ -8,7 +8,6 @@
 #include "Misc/PackageName.h"
 #include "GameplayTagContainer.h"
 #include "Engine/DataTable.h"
-#include "Kismet/DataTableFunctionLibrary.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "AssetToolsModule.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -42,6 +41,22 @@
 #include "GameplayEffectComponents/CancelAbilityTagsGameplayEffectComponent.h"
 #include "Misc/SecureHash.h"
 #include "Serialization/ArchiveUObject.h"
+#include "Async/ParallelFor.h"
+#include "Hash/xxhash.h"
+#include "AbilityEditorJsonRowReader.h"
+#include "AbilityEditorSpreadsheetReader.h"
+#include "AbilityEditorBinaryRowReader.h"
+#include "AbilityEditorRowArena.h"
+#include "AbilityEditorStructHash.h"
+#include "AbilityEditorImportManifest.h"
+#include "AbilityEditorImportReport.h"
+#include "AbilityEditorAssetStamp.h"
+#include "AbilityEditorBulkImportScope.h"
+#include "AbilityEditorRowShard.h"
+#include "AbilityEditorAssetPathCache.h"
+#include "AbilityEditorAttributeIndex.h"
+#include "AbilityEditorImportJob.h"
+#include "AbilityEditorRowAssetType.h"
 
 #if WITH_EDITOR
 #include "EditorUtilitySubsystem.h"
@@ -95,95 +110,245 @@ namespace
 	}
 
 	/**
-	 * 从路径加载类
+	 * 按路径引用类/对象失败的累计次数（所有按路径的引用解析都经由 CountReferenceLookup 计入）
+	 * 生成某行期间有引用未能解析时不写入配置印记，待被引用的资产生成后下次导入会重新应用该行
 	 */
+	static int32 GUnresolvedReferenceCount = 0;
+
+	/** 记录一次引用解析的结果：路径非空但未能解析时计入 GUnresolvedReferenceCount */
+	static void CountReferenceLookup(const FString& InPath, const UObject* Resolved)
+	{
+		if (!Resolved && !InPath.IsEmpty())
+		{
+			++GUnresolvedReferenceCount;
+		}
+	}
+
+	/**
+	 * 解析属性引用（Modifier Attribute、BackingAttribute 等）
+	 * 非空字符串解析失败时与类/对象引用一样计入 GUnresolvedReferenceCount：AttributeSet 修复后该行需要重新应用
+	 */
+	static bool ResolveAttributeReference(const FString& AttributeString, FGameplayAttribute& OutAttribute)
+	{
+		const bool bResolved = UAbilityEditorHelperLibrary::ParseAttributeString(AttributeString, OutAttribute);
+		if (!bResolved && !AttributeString.IsEmpty())
+		{
+			++GUnresolvedReferenceCount;
+		}
+		return bResolved;
+	}
+
+	/** LoadClassFromPath 的实现（不计入失败次数） */
 	template<typename T>
-	static UClass* LoadClassFromPath(const FString& InPath)
+	static UClass* LoadClassFromPathUncounted(const FString& InPath, bool* bOutReportFailure)
 	{
+		if (bOutReportFailure)
+		{
+			*bOutReportFailure = false;
+		}
+
 		FString PackageName, AssetName, ObjectPath;
 		if (ParseAssetPath(InPath, PackageName, AssetName, ObjectPath))
 		{
-			return LoadClass<T>(nullptr, *ObjectPath);
+			return FAbilityEditorAssetPathCache::Get().FindOrLoadClass(ObjectPath, T::StaticClass(), bOutReportFailure);
 		}
 		return nullptr;
 	}
 
-	/**
-	 * 从路径加载对象
-	 */
+	/** LoadObjectFromPath 的实现（不计入失败次数） */
 	template<typename T>
-	static T* LoadObjectFromPath(const FString& InPath)
+	static T* LoadObjectFromPathUncounted(const FString& InPath, bool* bOutReportFailure)
 	{
+		if (bOutReportFailure)
+		{
+			*bOutReportFailure = false;
+		}
+
 		FString PackageName, AssetName, ObjectPath;
 		if (ParseAssetPath(InPath, PackageName, AssetName, ObjectPath))
 		{
-			return Cast<T>(StaticLoadObject(T::StaticClass(), nullptr, *ObjectPath));
+			return Cast<T>(FAbilityEditorAssetPathCache::Get().FindOrLoadObject(ObjectPath, T::StaticClass(), bOutReportFailure));
 		}
 		return nullptr;
 	}
 
 	/**
-	 * 获取基础配置与 DataTable
+	 * 从路径加载类（批量导入期间经由路径缓存，同一路径只加载一次）
+	 * @param bOutReportFailure  加载失败且需要输出警告时为 true（同一导入会话中每个路径只报告一次）
 	 */
-	static bool GetSettingsAndDataTable(const UAbilityEditorHelperSettings*& OutSettings, UDataTable*& OutDataTable)
+	template<typename T>
+	static UClass* LoadClassFromPath(const FString& InPath, bool* bOutReportFailure = nullptr)
 	{
-		OutSettings = GetDefault<UAbilityEditorHelperSettings>();
-		if (!OutSettings)
+		UClass* Class = LoadClassFromPathUncounted<T>(InPath, bOutReportFailure);
+		CountReferenceLookup(InPath, Class);
+		return Class;
+	}
+
+	/**
+	 * 从路径加载对象（批量导入期间经由路径缓存，同一路径只加载一次）
+	 * @param bOutReportFailure  同 LoadClassFromPath
+	 */
+	template<typename T>
+	static T* LoadObjectFromPath(const FString& InPath, bool* bOutReportFailure = nullptr)
+	{
+		T* Object = LoadObjectFromPathUncounted<T>(InPath, bOutReportFailure);
+		CountReferenceLookup(InPath, Object);
+		return Object;
+	}
+
+	/**
+	 * 统一导入期间已生成的蓝图类（按包名索引）
+	 * 类引用指向同一次导入中生成的蓝图（如 GA）时直接取内存中的生成类，不再按路径同步加载
+	 * 普通资产（如 GE 对象）不是类，不登记：否则其 GetClass() 为 UGameplayEffect 等基类，类引用会被错误解析为基类
+	 */
+	struct FImportedClassRegistry
+	{
+		TMap<FName, TWeakObjectPtr<UClass>> ClassesByPackage;
+
+		/** @param Asset  行类型 ApplyRow 的返回值：蓝图资产或其生成类的 CDO 时登记生成类，其余忽略 */
+		void Register(const UObject* Asset)
 		{
-			return false;
+			UClass* GeneratedClass = nullptr;
+			if (const UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+			{
+				GeneratedClass = Blueprint->GeneratedClass;
+			}
+			else if (Asset && Asset->HasAnyFlags(RF_ClassDefaultObject))
+			{
+				GeneratedClass = Asset->GetClass();
+			}
+
+			if (GeneratedClass)
+			{
+				ClassesByPackage.Add(GeneratedClass->GetPackage()->GetFName(), GeneratedClass);
+			}
 		}
+	};
 
-		OutDataTable = OutSettings->GameplayEffectDataTable.IsValid() ? OutSettings->GameplayEffectDataTable.Get() : nullptr;
-		if (!OutDataTable)
+	/** 当前生效的注册表（仅统一导入期间有效） */
+	static FImportedClassRegistry* GActiveImportedClassRegistry = nullptr;
+
+	/** ResolveClassFromPath 的实现（不计入失败次数） */
+	template<typename T>
+	static UClass* ResolveClassFromPathUncounted(const FString& InPath, bool* bOutReportFailure)
+	{
+		if (bOutReportFailure)
 		{
-			OutDataTable = OutSettings->GameplayEffectDataTable.LoadSynchronous();
+			*bOutReportFailure = false;
 		}
 
-		return OutDataTable != nullptr;
+		if (GActiveImportedClassRegistry)
+		{
+			FString PackageName, AssetName, ObjectPath;
+			if (ParseAssetPath(InPath, PackageName, AssetName, ObjectPath))
+			{
+				if (const TWeakObjectPtr<UClass>* Found = GActiveImportedClassRegistry->ClassesByPackage.Find(FName(*PackageName)))
+				{
+					UClass* Class = Found->Get();
+					if (Class && Class->IsChildOf(T::StaticClass()))
+					{
+						return Class;
+					}
+				}
+			}
+		}
+		return LoadClassFromPathUncounted<T>(InPath, bOutReportFailure);
 	}
 
 	/**
-	 * 获取 GE 资产的基础存放路径
+	 * 解析类引用：优先使用统一导入中已生成的类，否则从路径加载
 	 */
-	static FString GetGameplayEffectBasePath(const UAbilityEditorHelperSettings* Settings)
+	template<typename T>
+	static UClass* ResolveClassFromPath(const FString& InPath, bool* bOutReportFailure = nullptr)
 	{
-		if (!Settings) return TEXT("/Game/GameplayEffects");
-		
-		FString BasePath = Settings->GameplayEffectPath;
-		if (BasePath.IsEmpty())
+		UClass* Class = ResolveClassFromPathUncounted<T>(InPath, bOutReportFailure);
+		CountReferenceLookup(InPath, Class);
+		return Class;
+	}
+
+	/**
+	 * 解析 GE 的 ParentClass：类路径（蓝图 GE 的生成类或 C++ 类）按类解析；
+	 * 非蓝图 GE 资产的路径不是类引用，取该资产的类。两者都失败才计为一次未解析的引用
+	 */
+	static UClass* ResolveGameplayEffectParentClass(const FString& InPath, bool* bOutReportFailure = nullptr)
+	{
+		if (bOutReportFailure)
+		{
+			*bOutReportFailure = false;
+		}
+
+		UClass* Class = ResolveClassFromPathUncounted<UGameplayEffect>(InPath, nullptr);
+		if (!Class)
+		{
+			if (const UGameplayEffect* ParentGE = LoadObjectFromPathUncounted<UGameplayEffect>(InPath, bOutReportFailure))
+			{
+				Class = ParentGE->GetClass();
+			}
+		}
+		CountReferenceLookup(InPath, Class);
+		return Class;
+	}
+
+	/**
+	 * 加载 Settings 中配置的 DataTable
+	 * @param SettingName  设置项名称（日志使用）
+	 */
+	static UDataTable* LoadSettingsDataTable(const TSoftObjectPtr<UDataTable>& DataTableSetting, const TCHAR* SettingName)
+	{
+		UDataTable* DataTable = DataTableSetting.IsValid() ? DataTableSetting.Get() : DataTableSetting.LoadSynchronous();
+		if (!DataTable)
 		{
-			BasePath = TEXT("/Game/GameplayEffects");
+			UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] %s 未配置或加载失败"), SettingName);
 		}
+		return DataTable;
+	}
+
+	/**
+	 * 规范化资产输出目录：未配置时使用 DefaultPath，补全 /Game/ 前缀并去掉末尾斜杠
+	 */
+	static FString NormalizeAssetBasePath(const FString& ConfiguredPath, const TCHAR* DefaultPath)
+	{
+		FString BasePath = ConfiguredPath.IsEmpty() ? FString(DefaultPath) : ConfiguredPath;
 		if (!BasePath.StartsWith(TEXT("/")))
 		{
 			BasePath = TEXT("/Game/") + BasePath;
 		}
-		// 去掉末尾斜杠
-		if (BasePath.EndsWith(TEXT("/")))
+		BasePath.RemoveFromEnd(TEXT("/"));
+		return BasePath;
+	}
+
+	/** 与创建时一致的资产命名规则：行名不含前缀时补上前缀 */
+	static FName MakeRowAssetName(FName RowName, const TCHAR* Prefix)
+	{
+		FString RowAssetName = RowName.ToString();
+		if (!RowAssetName.Contains(Prefix))
 		{
-			BasePath.LeftChopInline(1);
+			RowAssetName = Prefix + RowAssetName;
 		}
-		return BasePath;
+		return FName(*RowAssetName);
+	}
+
+	/** 行对应的资产路径（BasePath/资产名） */
+	static FString MakeRowAssetPath(const FString& BasePath, FName RowName, const TCHAR* Prefix)
+	{
+		return FString::Printf(TEXT("%s/%s"), *BasePath, *MakeRowAssetName(RowName, Prefix).ToString());
 	}
 
 #if WITH_EDITOR
 	/**
-	 * 清理指定目录下不在 DataTable 中的 GE 资产
+	 * 查找目录下已不对应 DataTable 中任何行的生成资产（仅读取 FAssetData，不加载资产）
+	 * - 带来源标签的资产：来源为该 DataTable，且行已删除或资产名与该行的命名不一致时为孤儿；来源为其他 DataTable 的资产不处理
+	 * - 无来源标签的资产（旧版本生成或手工创建）：沿用按命名规则匹配行名的判断
 	 */
-	static void CleanupGameplayEffectFolder(const FString& BasePath, const UDataTable* DataTable)
+	static void FindOrphanedGeneratedAssets(const FString& BasePath, const FTopLevelAssetPath& AssetClassPath, const UDataTable* DataTable, const TCHAR* Prefix, TArray<FAssetData>& OutOrphans)
 	{
-		if (BasePath.IsEmpty() || !DataTable) return;
+		OutOrphans.Reset();
 
-		// 预构建 DataTable 中期望存在的 GE 资产名集合（与创建时的命名规则一致）
+		// 预构建 DataTable 中期望存在的资产名集合
 		TSet<FName> DesiredAssetNames;
 		for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
 		{
-			FString RowAssetName = RowPair.Key.ToString();
-			if (!RowAssetName.Contains(TEXT("GE_")))
-			{
-				RowAssetName = TEXT("GE_") + RowAssetName;
-			}
-			DesiredAssetNames.Add(FName(*RowAssetName));
+			DesiredAssetNames.Add(MakeRowAssetName(RowPair.Key, Prefix));
 		}
 
 		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
@@ -192,28 +357,59 @@ namespace
 		FARFilter Filter;
 		Filter.bRecursivePaths = true;
 		Filter.PackagePaths.Add(FName(*BasePath));
-		Filter.ClassPaths.Add(UGameplayEffect::StaticClass()->GetClassPathName());
+		Filter.ClassPaths.Add(AssetClassPath);
 
 		TArray<FAssetData> Assets;
 		AssetRegistry.GetAssets(Filter, Assets);
 
-		TArray<UObject*> ObjectsToDelete;
-		ObjectsToDelete.Reserve(Assets.Num());
+		const FString DataTablePath = DataTable->GetPathName();
+		FString SourceTable;
+		FName SourceRow;
+		FString Stamp;
 		for (const FAssetData& AssetData : Assets)
 		{
-			// 若该 GE 名称不在 DataTable 目标集合中，则标记删除
-			if (!DesiredAssetNames.Contains(AssetData.AssetName))
+			if (FAbilityEditorAssetStamp::ReadFromAssetData(AssetData, SourceTable, SourceRow, Stamp))
 			{
-				if (UObject* Obj = AssetData.GetAsset())
+				if (SourceTable == DataTablePath
+					&& (!DataTable->GetRowMap().Contains(SourceRow) || MakeRowAssetName(SourceRow, Prefix) != AssetData.AssetName))
 				{
-					ObjectsToDelete.Add(Obj);
+					OutOrphans.Add(AssetData);
 				}
 			}
+			else if (!DesiredAssetNames.Contains(AssetData.AssetName))
+			{
+				OutOrphans.Add(AssetData);
+			}
+		}
+	}
+
+	/**
+	 * 清理输出目录（含子目录）下不再对应 DataTable 中任何行的生成资产（只加载需要删除的资产）
+	 */
+	static void CleanupGeneratedAssetFolder(const FAbilityEditorRowAssetType& Type, const FString& BasePath, const UDataTable* DataTable)
+	{
+		if (BasePath.IsEmpty() || !DataTable)
+		{
+			return;
+		}
+
+		TArray<FAssetData> Orphans;
+		FindOrphanedGeneratedAssets(BasePath, Type.AssetClassPath, DataTable, *Type.AssetPrefix, Orphans);
+
+		TArray<UObject*> ObjectsToDelete;
+		ObjectsToDelete.Reserve(Orphans.Num());
+		for (const FAssetData& AssetData : Orphans)
+		{
+			if (UObject* Obj = AssetData.GetAsset())
+			{
+				ObjectsToDelete.Add(Obj);
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 清理不在 DataTable 中的 %s 资产：%s"), *Type.Name.ToString(), *AssetData.AssetName.ToString());
+			}
 		}
 
 		if (ObjectsToDelete.Num() > 0)
 		{
-			UE_LOG(LogTemp, Log, TEXT("[AbilityEditorHelper] 清理 %d 个未在 DataTable 中的 GE 资产。"), ObjectsToDelete.Num());
+			UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 清理 %d 个未在 DataTable 中的 %s 资产。"), ObjectsToDelete.Num(), *Type.Name.ToString());
 			ObjectTools::DeleteObjectsUnchecked(ObjectsToDelete);
 		}
 	}
@@ -357,9 +553,8 @@ UBlueprint* UAbilityEditorHelperLibrary::CreateBlueprintAsset(const FString& Blu
 
 	if (NewBlueprint)
 	{
-		// 注册到资产注册表，并标记脏包
-		FAssetRegistryModule::AssetCreated(NewBlueprint);
-		const bool bPackageDirtyResult = NewBlueprint->MarkPackageDirty();
+		// 注册到资产注册表，并标记脏包（批量导入作用域内延迟统一通知）
+		FAbilityEditorBulkImportScope::AssetCreated(NewBlueprint);
 
 		bOutSuccess = true;
 	}
@@ -435,16 +630,9 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 	// 若已存在且提供了 ParentClass，比较现有 GE 的父类与配置的父类，不一致则删除资产以触发重建
 	if (GE && !Config.ParentClass.IsEmpty())
 	{
-		UClass* DesiredParentClass = LoadClassFromPath<UGameplayEffect>(Config.ParentClass);
-
-		// 回退：若不是类路径，则当作 GE 资产路径加载，再取其 Class
-		if (!DesiredParentClass)
-		{
-			if (UGameplayEffect* ParentGEObj = LoadObjectFromPath<UGameplayEffect>(Config.ParentClass))
-			{
-				DesiredParentClass = ParentGEObj->GetClass();
-			}
-		}
+		// 类路径或 GE 资产路径（取其 Class）
+		bool bReportFailure = false;
+		UClass* DesiredParentClass = ResolveGameplayEffectParentClass(Config.ParentClass, &bReportFailure);
 
 		if (DesiredParentClass)
 		{
@@ -462,7 +650,7 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 				GE = nullptr; // 置空以走创建流程
 			}
 		}
-		else
+		else if (bReportFailure)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 无法加载 ParentClass 指定的类型：%s"), *Config.ParentClass);
 		}
@@ -485,7 +673,8 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 		// 优先：根据 Config.ParentClass 复制父 GE 资产作为新资产
 		if (!Config.ParentClass.IsEmpty())
 		{
-			if (UClass* ParentGEClass = LoadClassFromPath<UGameplayEffect>(Config.ParentClass))
+			bool bReportFailure = false;
+			if (UClass* ParentGEClass = ResolveGameplayEffectParentClass(Config.ParentClass, &bReportFailure))
 			{
 				if (UGameplayEffect* Duplicated = NewObject<UGameplayEffect>(Package, ParentGEClass, FName(*AssetName), RF_Public | RF_Standalone | RF_Transactional))
 				{
@@ -498,7 +687,7 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 					UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 从 ParentClass 复制 GE 失败：%s，将回退到默认创建"), *Config.ParentClass);
 				}
 			}
-			else
+			else if (bReportFailure)
 			{
 				UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 无法加载 ParentClass GE：%s，将回退到默认创建"), *Config.ParentClass);
 			}
@@ -523,8 +712,7 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 			}
 		}
 
-		FAssetRegistryModule::AssetCreated(GE);
-		Package->MarkPackageDirty();
+		FAbilityEditorBulkImportScope::AssetCreated(GE);
 		bIsNewlyCreated = true;
 	}
 
@@ -615,13 +803,14 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 
 			for (const FString& AbilityClassPath : Config.GrantedAbilityClasses)
 			{
-				if (UClass* AbilityClass = LoadClassFromPath<UGameplayAbility>(AbilityClassPath))
+				bool bReportFailure = false;
+				if (UClass* AbilityClass = ResolveClassFromPath<UGameplayAbility>(AbilityClassPath, &bReportFailure))
 				{
 					FGameplayAbilitySpecConfig SpecConfig;
 					SpecConfig.Ability = AbilityClass;
 					AbilityConfigs.Add(SpecConfig);
 				}
-				else if (!AbilityClassPath.IsEmpty())
+				else if (bReportFailure)
 				{
 					UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 无法加载 Ability 类：%s"), *AbilityClassPath);
 				}
@@ -630,11 +819,8 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 			// 通过 UE 反射访问 protected 成员 GrantAbilityConfigs
 			if (AbilityConfigs.Num() > 0)
 			{
-				FArrayProperty* GrantAbilityConfigsProp = CastField<FArrayProperty>(
-					UAbilitiesGameplayEffectComponent::StaticClass()->FindPropertyByName(TEXT("GrantAbilityConfigs"))
-				);
-
-				if (GrantAbilityConfigsProp)
+				// 句柄未解析时已在模块启动时报告
+				if (FArrayProperty* GrantAbilityConfigsProp = FAbilityEditorPropertyHandles::Get().GrantAbilityConfigs)
 				{
 					TArray<FGameplayAbilitySpecConfig>* GrantAbilityConfigsPtr =
 						GrantAbilityConfigsProp->ContainerPtrToValuePtr<TArray<FGameplayAbilitySpecConfig>>(&AbilitiesComp);
@@ -644,10 +830,6 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 						*GrantAbilityConfigsPtr = AbilityConfigs;
 					}
 				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 无法通过反射找到 GrantAbilityConfigs 属性"));
-				}
 			}
 		}
 		else
@@ -686,7 +868,7 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 		{
 			// 通过简化字符串解析 Attribute
 			FGameplayAttribute ParsedAttribute;
-			if (!ParseAttributeString(Mod.Attribute, ParsedAttribute))
+			if (!ResolveAttributeReference(Mod.Attribute, ParsedAttribute))
 			{
 				UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 跳过无效的 Modifier Attribute：%s"), *Mod.Attribute);
 				continue;
@@ -712,7 +894,7 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 
 				// 解析 BackingAttribute 字符串
 				FGameplayAttribute BackingAttribute;
-				if (ParseAttributeString(Mod.AttributeBasedConfig.BackingAttribute, BackingAttribute))
+				if (ResolveAttributeReference(Mod.AttributeBasedConfig.BackingAttribute, BackingAttribute))
 				{
 					// 创建 Attribute Capture Definition
 					FGameplayEffectAttributeCaptureDefinition CaptureDef;
@@ -745,12 +927,17 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 
 			case EGameplayEffectMagnitudeCalculation::CustomCalculationClass:
 			{
-				if (UClass* CalcClass = LoadClassFromPath<UGameplayModMagnitudeCalculation>(Mod.CustomCalculationClass))
+				bool bReportFailure = false;
+				if (UClass* CalcClass = LoadClassFromPath<UGameplayModMagnitudeCalculation>(Mod.CustomCalculationClass, &bReportFailure))
 				{
 					FCustomCalculationBasedFloat CustomCalc;
 					CustomCalc.CalculationClassMagnitude = CalcClass;
 					Info.ModifierMagnitude = FGameplayEffectModifierMagnitude(CustomCalc);
 				}
+				else if (bReportFailure)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 无法加载 CustomCalculationClass：%s"), *Mod.CustomCalculationClass);
+				}
 				break;
 			}
 			default:
@@ -826,16 +1013,17 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 			{
 				if (!ExecConfig.CalculationClass.IsEmpty())
 				{
-					FString ExecPackageName, ExecAssetName, ExecObjectPath;
-					if (ParseAssetPath(ExecConfig.CalculationClass, ExecPackageName, ExecAssetName, ExecObjectPath))
+					bool bReportFailure = false;
+					if (UClass* CalcClass = LoadClassFromPath<UGameplayEffectExecutionCalculation>(ExecConfig.CalculationClass, &bReportFailure))
 					{
-						if (UClass* CalcClass = LoadClass<UGameplayEffectExecutionCalculation>(nullptr, *ExecObjectPath))
-						{
-							FGameplayEffectExecutionDefinition ExecDef;
-							ExecDef.CalculationClass = CalcClass;
-							ExecDef.PassedInTags = ExecConfig.PassedInTags;
-							GE->Executions.Add(ExecDef);
-						}
+						FGameplayEffectExecutionDefinition ExecDef;
+						ExecDef.CalculationClass = CalcClass;
+						ExecDef.PassedInTags = ExecConfig.PassedInTags;
+						GE->Executions.Add(ExecDef);
+					}
+					else if (bReportFailure)
+					{
+						UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 无法加载 Execution CalculationClass：%s"), *ExecConfig.CalculationClass);
 					}
 				}
 			}
@@ -853,14 +1041,14 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 		// 变更检测：仅在属性实际发生变化时才标记脏包
 		if (bIsNewlyCreated)
 		{
-			GE->MarkPackageDirty();
+			FAbilityEditorBulkImportScope::MarkPackageDirty(GE);
 		}
 		else
 		{
 			TArray<uint8> AfterBytes = SerializeObjectState(GE);
 			if (BeforeBytes != AfterBytes)
 			{
-				GE->MarkPackageDirty();
+				FAbilityEditorBulkImportScope::MarkPackageDirty(GE);
 				UE_LOG(LogTemp, Log, TEXT("[AbilityEditorHelper] GE 已变更，标记脏包：%s"), *GE->GetName());
 			}
 			else
@@ -879,161 +1067,491 @@ UGameplayEffect* UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(const
 #endif
 }
 
-void UAbilityEditorHelperLibrary::CreateOrUpdateGameplayEffectsFromSettings(bool bClearGameplayEffectFolderFirst)
+// ===================== 批量生成的输入指纹 =====================
+
+namespace
 {
-	const UAbilityEditorHelperSettings* Settings = nullptr;
-	UDataTable* DataTable = nullptr;
-	if (!GetSettingsAndDataTable(Settings, DataTable))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] Settings 未找到或 DataTable 未设置。"));
-		return;
-	}
+	static FString MakeStructSignatureHash(UScriptStruct* Struct);
 
-	// 校验行结构（支持 FGameplayEffectConfig 及其派生类）
-	if (!DataTable->GetRowStruct() || !DataTable->GetRowStruct()->IsChildOf(FGameplayEffectConfig::StaticStruct()))
+	/**
+	 * 计算批量生成的输入指纹：DataTable 内容、影响生成结果的设置、插件版本、行结构 Schema Hash、输出目录下的资产数量及清理选项
+	 * 任一输入变化（含手动删除生成的资产）都会得到不同的指纹
+	 */
+	static FString MakeGenerationFingerprint(const UAbilityEditorHelperSettings* Settings, const UDataTable* DataTable, const FString& BasePath, bool bClearFolderFirst)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] DataTable 行结构不是 FGameplayEffectConfig 或其派生类，无法导入。"));
-		return;
-	}
+		FXxHash64Builder Builder;
+		auto HashString = [&Builder](const FString& Value)
+		{
+			const int32 Len = Value.Len();
+			Builder.Update(&Len, sizeof(Len));
+			Builder.Update(*Value, Len * sizeof(TCHAR));
+		};
+		auto HashUInt64 = [&Builder](uint64 Value)
+		{
+			Builder.Update(&Value, sizeof(Value));
+		};
 
-	// 规范化基础路径
-	FString BasePath = GetGameplayEffectBasePath(Settings);
+		// DataTable 内容（行名 + 行内容哈希）
+		UScriptStruct* RowStruct = const_cast<UScriptStruct*>(DataTable->GetRowStruct());
+		HashUInt64(DataTable->GetRowMap().Num());
+		for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
+		{
+			HashString(RowPair.Key.ToString());
+			HashUInt64(RowPair.Value ? FAbilityEditorStructHash::HashStruct(RowStruct, RowPair.Value) : 0);
+		}
+
+		// 影响生成结果的设置、Schema 与清理选项
+		HashUInt64(Settings->GetGenerationSettingsHash());
+		HashString(MakeStructSignatureHash(RowStruct));
+		HashString(BasePath);
+		HashUInt64(bClearFolderFirst ? 1 : 0);
+
+		// 插件版本：生成逻辑升级后需要全部重新生成
+		if (const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("AbilityEditorHelper")))
+		{
+			HashUInt64(static_cast<uint64>(Plugin->GetDescriptor().Version));
+			HashString(Plugin->GetDescriptor().VersionName);
+		}
 
 #if WITH_EDITOR
-	// 可选：在导入前清理 BasePath 下（含子目录）中不在 DataTable 的 GE 资产
-	if (bClearGameplayEffectFolderFirst)
-	{
-		CleanupGameplayEffectFolder(BasePath, DataTable);
-	}
+		// 输出目录下的资产数量：生成的资产被手动删除时指纹变化
+		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+		TArray<FAssetData> AssetDataList;
+		AssetRegistryModule.Get().GetAssetsByPath(FName(*BasePath), AssetDataList, true);
+		HashUInt64(AssetDataList.Num());
 #endif
 
-	// 遍历每一行并创建/更新 GE，打印结果
-	for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
+		return FAbilityEditorImportManifest::HashToString(Builder.Finalize().Hash);
+	}
+
+	/**
+	 * 判断输入指纹是否与上次成功的批量生成一致
+	 * @param OutManifest  DataTable 对应的清单（不存在时返回只含清单头的空清单），供成功后写回指纹
+	 */
+	static bool IsGenerationUpToDate(const UDataTable* DataTable, const FString& Fingerprint, FAbilityEditorImportManifest& OutManifest)
 	{
-		const FName RowName = RowPair.Key;
-		const uint8* RowData = RowPair.Value;
-		if (!RowData)
+		UScriptStruct* RowStruct = const_cast<UScriptStruct*>(DataTable->GetRowStruct());
+		const FString SchemaHash = MakeStructSignatureHash(RowStruct);
+		if (!FAbilityEditorImportManifest::Load(DataTable, SchemaHash, OutManifest))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 行 %s 数据为空，已跳过。"), *RowName.ToString());
-			continue;
+			OutManifest.ResetHeader(DataTable, SchemaHash);
+			return false;
 		}
+		return OutManifest.GenerationFingerprint == Fingerprint;
+	}
 
-		const FGameplayEffectConfig* Config = reinterpret_cast<const FGameplayEffectConfig*>(RowData);
-		FString RowAssetName = RowName.ToString();
-		if (!RowAssetName.Contains(TEXT("GE_")))
-		{
-			RowAssetName = TEXT("GE_") + RowAssetName;
-		}
-		const FString GEPath = FString::Printf(TEXT("%s/%s"), *BasePath, *RowAssetName);
+	/**
+	 * 一次批量生成中各行共用的配置印记上下文（见 FAbilityEditorAssetStamp）
+	 * 印记一致的行跳过加载与应用；生成期间有按路径的引用未能解析的行不写入印记
+	 */
+	struct FRowStampContext
+	{
+		uint64 ContextHash = 0;
+		const UScriptStruct* RowStruct = nullptr;
+		bool bForceFullUpdate = false;
+		int32 SkippedCount = 0;
 
-		bool bOK = false;
-		UGameplayEffect* GE = CreateOrImportGameplayEffect(GEPath, *Config, bOK);
-		if (bOK && GE)
+		FRowStampContext(const UAbilityEditorHelperSettings* Settings, const UDataTable* DataTable, bool bInForceFullUpdate)
+			: RowStruct(DataTable->GetRowStruct())
+			, bForceFullUpdate(bInForceFullUpdate)
 		{
-			UE_LOG(LogTemp, Log, TEXT("[AbilityEditorHelper] 成功创建/更新 GameplayEffect：%s"), *GEPath);
+			ContextHash = FAbilityEditorAssetStamp::MakeContextHash(Settings, MakeStructSignatureHash(const_cast<UScriptStruct*>(RowStruct)));
 		}
-		else
+
+		/**
+		 * 计算行印记并与资产现有印记比较
+		 * @return  印记一致（可跳过该行）时返回 true；bForceFullUpdate 时总是返回 false
+		 */
+		bool IsUpToDate(const FString& AssetPath, const uint8* RowData, FString& OutStamp)
 		{
-			UE_LOG(LogTemp, Error, TEXT("[AbilityEditorHelper] 创建/更新失败：%s"), *GEPath);
+			OutStamp = FAbilityEditorAssetStamp::Make(ContextHash, RowStruct, RowData);
+			if (!bForceFullUpdate && FAbilityEditorAssetStamp::Find(AssetPath) == OutStamp)
+			{
+				++SkippedCount;
+				return true;
+			}
+			return false;
 		}
-	}
-}
 
-// ===================== Schema 导出实现 =====================
+		/**
+		 * 生成成功后写入印记与来源标签
+		 * @param Generated           行类型 ApplyRow 的返回值（GE 对象、GA CDO 等）
+		 * @param UnresolvedBefore    生成该行之前的 GUnresolvedReferenceCount
+		 */
+		static void Apply(UObject* Generated, const FString& Stamp, const UDataTable* SourceTable, FName RowName, int32 UnresolvedBefore)
+		{
+			if (!Generated || GUnresolvedReferenceCount != UnresolvedBefore)
+			{
+				return;
+			}
 
-namespace
-{
-	static void FillEnumInfo(UEnum* Enum, FString& OutEnumPath, TArray<FString>& OutEnumValues)
-	{
-		OutEnumPath.Reset();
-		OutEnumValues.Reset();
-		if (!Enum) return;
+			UObject* Asset = Generated;
+#if WITH_EDITOR
+			// 返回 CDO 的行类型（如 GA）：印记写在生成该类的蓝图资产上
+			if (Generated->HasAnyFlags(RF_ClassDefaultObject))
+			{
+				Asset = UBlueprint::GetBlueprintFromClass(Generated->GetClass());
+			}
+#endif
+			FAbilityEditorAssetStamp::Apply(Asset, Stamp, SourceTable, RowName);
+		}
 
-		OutEnumPath = Enum->GetPathName();
-		const int32 Num = Enum->NumEnums();
-		for (int32 i = 0; i < Num; ++i)
+		void LogSkipped(const TCHAR* TypeName) const
 		{
-			const FString NameString = Enum->GetNameStringByIndex(i);
-			if (NameString.EndsWith(TEXT("_MAX")))
+			if (SkippedCount > 0)
 			{
-				continue;
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] %s：%d 行的配置印记与资产一致，已跳过"), TypeName, SkippedCount);
 			}
-			OutEnumValues.Add(NameString);
 		}
-	}
+	};
 
-	static FString GetPropertyKind(const FProperty* Prop)
+	/** 批量生成目标的上下文（由导入任务工厂按行类型解析后交给任务） */
+	struct FGenerationTargetInfo
 	{
-		if (CastField<FBoolProperty>(Prop)) return TEXT("bool");
-		if (CastField<FIntProperty>(Prop) || CastField<FInt64Property>(Prop) || CastField<FUInt32Property>(Prop) || CastField<FUInt64Property>(Prop)) return TEXT("int");
-		if (CastField<FFloatProperty>(Prop)) return TEXT("float");
-		if (CastField<FDoubleProperty>(Prop)) return TEXT("double");
-		if (CastField<FStrProperty>(Prop)) return TEXT("string");
-		if (CastField<FNameProperty>(Prop)) return TEXT("name");
-		if (CastField<FTextProperty>(Prop)) return TEXT("text");
-		if (CastField<FEnumProperty>(Prop)) return TEXT("enum");
+		/** 行类型（未注册时为空，bValid 为 false） */
+		TSharedPtr<const FAbilityEditorRowAssetType> Type;
+		FString TypeName;
+		const UAbilityEditorHelperSettings* Settings = nullptr;
+		TObjectPtr<UDataTable> DataTable = nullptr;
+		FString BasePath;
 
-		if (const FByteProperty* ByteProp = CastField<FByteProperty>(Prop))
-		{
-			if (ByteProp->Enum) return TEXT("enum");
-			return TEXT("int");
-		}
-		if (CastField<FStructProperty>(Prop)) return TEXT("struct");
-		if (CastField<FArrayProperty>(Prop)) return TEXT("array");
-		return TEXT("unknown");
-	}
+		/** 行类型已注册且 DataTable 有效 */
+		bool bValid = false;
 
-	static FString MakeStructSignatureHash(UScriptStruct* Struct)
-	{
-		if (!Struct) return TEXT("");
+		const TCHAR* GetTypeName() const { return *TypeName; }
+		const TCHAR* GetPrefix() const { return *Type->AssetPrefix; }
+		const UScriptStruct* GetExpectedRowStruct() const { return Type->RowStruct; }
 
-		FString Sig;
-		for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		/** 行结构是否为行类型的行结构或其派生类 */
+		bool HasExpectedRowStruct() const
 		{
-			const FProperty* Prop = *It;
-			Sig += Prop->GetName();
-			Sig += TEXT(":");
-			Sig += Prop->GetClass()->GetName();
-			Sig += TEXT(";");
+			return DataTable && DataTable->GetRowStruct() && DataTable->GetRowStruct()->IsChildOf(GetExpectedRowStruct());
 		}
-		return FMD5::HashAnsiString(*Sig);
-	}
 
-	static FString GetPluginPythonSchemaDir()
-	{
-		FString BaseDir;
+		/**
+		 * 按配置创建或更新一行对应的资产
+		 * @return  行类型 ApplyRow 的结果；失败返回 nullptr
+		 */
+		UObject* ApplyRow(const FString& AssetPath, const uint8* RowData) const
+		{
+			return Type->ApplyRow(AssetPath, RowData);
+		}
 
 #if WITH_EDITOR
-		if (IPluginManager::Get().FindPlugin(TEXT("AbilityEditorHelper")).IsValid())
+		/** 清理输出目录中不在 DataTable 的资产 */
+		void CleanupFolder() const
 		{
-			BaseDir = IPluginManager::Get().FindPlugin(TEXT("AbilityEditorHelper"))->GetBaseDir();
+			CleanupGeneratedAssetFolder(*Type, BasePath, DataTable);
 		}
 #endif
-		if (BaseDir.IsEmpty())
-		{
-			// 兜底：项目本地插件路径
-			BaseDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("Plugins/AbilityEditorHelper"));
-		}
-		return FPaths::Combine(BaseDir, TEXT("Content/Python/Schema"));
-	}
+	};
 
-	static bool EnsureDirectoryTree(const FString& Dir)
+	/** 解析行类型对应的 Settings、DataTable 与输出目录 */
+	static bool ResolveGenerationTarget(const FAbilityEditorRowAssetType& Type, const UAbilityEditorHelperSettings*& OutSettings, UDataTable*& OutDataTable, FString& OutBasePath)
 	{
-		IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
-		return PF.CreateDirectoryTree(*Dir);
+		OutSettings = GetDefault<UAbilityEditorHelperSettings>();
+		OutDataTable = nullptr;
+		return OutSettings && Type.ResolveTable(OutDataTable, OutBasePath) && OutDataTable && OutDataTable->GetRowStruct();
 	}
-}
 
-bool UAbilityEditorHelperLibrary::WriteStructSchemaToJson(UScriptStruct* StructType, const FString& OutJsonFilePath, FString& OutError)
-{
-	OutError.Reset();
-	if (OutJsonFilePath.IsEmpty())
+	/** 按行类型名称填写生成目标上下文（导入任务工厂与生成状态查询共用） */
+	static FGenerationTargetInfo MakeGenerationTargetInfo(FName RowType)
 	{
-		OutError = TEXT("StructPath 或 OutJsonFilePath 为空");
-		return false;
+		FGenerationTargetInfo Info;
+		Info.TypeName = RowType.ToString();
+		Info.Type = FAbilityEditorRowAssetTypeRegistry::Find(RowType);
+		if (!Info.Type)
+		{
+			UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 行类型 %s 未注册"), *Info.TypeName);
+			return Info;
+		}
+
+		UDataTable* DataTable = nullptr;
+		Info.bValid = ResolveGenerationTarget(*Info.Type, Info.Settings, DataTable, Info.BasePath);
+		Info.DataTable = DataTable;
+		return Info;
 	}
 
-	if (!StructType)
+	/**
+	 * 单张 DataTable 的批量生成：每行一个步骤，印记一致的行在步骤内直接跳过
+	 * 异步导入的两帧之间 DataTable 可能被编辑，步骤按行名重新查找行数据
+	 */
+	class FTableGenerationJob : public FAbilityEditorImportJob
+	{
+	public:
+		FTableGenerationJob(const FGenerationTargetInfo& InInfo, bool bInClearFolderFirst, bool bInForceFullUpdate)
+			: Info(InInfo)
+			, bClearFolderFirst(bInClearFolderFirst)
+			, bForceFullUpdate(bInForceFullUpdate)
+			, Shard(FAbilityEditorRowShard::GetCurrent())
+		{
+		}
+
+		virtual FText GetDisplayName() const override
+		{
+			return FText::Format(NSLOCTEXT("AbilityEditorHelper", "TableGenerationJob", "批量生成 {0}"), FText::FromString(Info.GetTypeName()));
+		}
+
+		virtual bool Prepare(bool& bOutSuccess) override
+		{
+			bOutSuccess = false;
+			if (!Info.bValid)
+			{
+				UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] Settings 未找到或 DataTable 未设置。"));
+				return false;
+			}
+
+			// 校验行结构（支持配置结构体的派生类）
+			if (!Info.HasExpectedRowStruct())
+			{
+				UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] DataTable 行结构不是 %s 或其派生类，无法导入。"), *Info.GetExpectedRowStruct()->GetName());
+				return false;
+			}
+
+			// 分片工作进程只处理自己分片的行，输入指纹由协调进程统一检查和记录
+			if (Shard.IsSharded())
+			{
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 分片生成 %s：分片 %d / %d"), Info.GetTypeName(), Shard.Index, Shard.Count);
+				return true;
+			}
+
+			// 输入与上次成功的批量生成完全一致时直接返回
+			const FString Fingerprint = MakeGenerationFingerprint(Info.Settings, Info.DataTable, Info.BasePath, bClearFolderFirst);
+			if (IsGenerationUpToDate(Info.DataTable, Fingerprint, Manifest) && !bForceFullUpdate)
+			{
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 输入指纹未变化，%s 无需更新（可使用 bForceFullUpdate 强制更新）。"), Info.GetTypeName());
+				bOutSuccess = true;
+				return false;
+			}
+			return true;
+		}
+
+		virtual bool BeginAssetStage() override
+		{
+#if WITH_EDITOR
+			// 可选：在导入前清理 BasePath 下（含子目录）中不在 DataTable 的资产（分片模式下只由 0 号分片清理）
+			if (bClearFolderFirst && Shard.Index == 0)
+			{
+				Info.CleanupFolder();
+			}
+#endif
+
+			for (const TPair<FName, uint8*>& RowPair : Info.DataTable->GetRowMap())
+			{
+				if (!RowPair.Value)
+				{
+					UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 行 %s 数据为空，已跳过。"), *RowPair.Key.ToString());
+					continue;
+				}
+				if (Shard.Contains(RowPair.Key))
+				{
+					RowNames.Add(RowPair.Key);
+				}
+			}
+
+			StampContext.Emplace(Info.Settings, Info.DataTable, bForceFullUpdate);
+			return true;
+		}
+
+		virtual int32 GetNumAssetSteps() const override
+		{
+			return RowNames.Num();
+		}
+
+		virtual void ExecuteAssetStep(int32 StepIndex) override
+		{
+			const FName RowName = RowNames[StepIndex];
+			const uint8* RowData = Info.DataTable->FindRowUnchecked(RowName);
+			if (!RowData)
+			{
+				return;
+			}
+
+			const FString AssetPath = MakeRowAssetPath(Info.BasePath, RowName, Info.GetPrefix());
+
+			// 资产由同一份配置生成：无需加载和重新应用
+			FString Stamp;
+			if (StampContext->IsUpToDate(AssetPath, RowData, Stamp))
+			{
+				return;
+			}
+
+			const int32 UnresolvedBefore = GUnresolvedReferenceCount;
+			if (UObject* Asset = Info.ApplyRow(AssetPath, RowData))
+			{
+				FRowStampContext::Apply(Asset, Stamp, Info.DataTable, RowName, UnresolvedBefore);
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 成功创建/更新 %s：%s"), Info.GetTypeName(), *AssetPath);
+				++SuccessCount;
+			}
+			else
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 创建/更新失败：%s"), *AssetPath);
+				++FailCount;
+			}
+		}
+
+		virtual bool Finish(FAbilityEditorBulkImportScope& Scope, int32 NumStepsDone) override
+		{
+			const bool bCancelled = NumStepsDone < RowNames.Num();
+			StampContext->LogSkipped(Info.GetTypeName());
+			if (bCancelled)
+			{
+				UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] %s 导入已取消：已处理 %d / %d 行，成功 %d 个，失败 %d 个"),
+					Info.GetTypeName(), NumStepsDone, RowNames.Num(), SuccessCount, FailCount);
+			}
+			else
+			{
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] %s 导入完成：成功 %d 个，失败 %d 个"), Info.GetTypeName(), SuccessCount, FailCount);
+			}
+
+			// 先刷新通知，使新建资产进入资产注册表；可选：保存本次新建或变化的包（保存失败视为未全部成功）
+			Scope.Flush();
+			bool bSaved = true;
+			if (Info.Settings->bSaveChangedPackagesAfterImport && Scope.IsRootScope())
+			{
+				bSaved = Scope.SaveTouchedPackages();
+			}
+
+			// 全部成功并已保存后记录指纹（生成过程可能新建资产，需重新计算）；取消时剩余的行尚未生成，不记录
+			const bool bAllSucceeded = FailCount == 0 && !bCancelled && bSaved;
+			if (bAllSucceeded && !Shard.IsSharded())
+			{
+				Manifest.GenerationFingerprint = MakeGenerationFingerprint(Info.Settings, Info.DataTable, Info.BasePath, bClearFolderFirst);
+				Manifest.Save(Info.DataTable);
+			}
+			return bAllSucceeded;
+		}
+
+		virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+		{
+			Collector.AddReferencedObject(Info.DataTable);
+		}
+
+		virtual FString GetReferencerName() const override
+		{
+			return TEXT("FTableGenerationJob");
+		}
+
+	private:
+		FGenerationTargetInfo Info;
+		bool bClearFolderFirst = false;
+		bool bForceFullUpdate = false;
+
+		/** 创建任务时的分片（分片工作进程只处理自己分片的行） */
+		FAbilityEditorRowShard Shard;
+
+		/** 清单（保存指纹用） */
+		FAbilityEditorImportManifest Manifest;
+
+		/** 本分片要处理的行（保持 DataTable 中的顺序） */
+		TArray<FName> RowNames;
+
+		TOptional<FRowStampContext> StampContext;
+		int32 SuccessCount = 0;
+		int32 FailCount = 0;
+	};
+}
+
+bool UAbilityEditorHelperLibrary::CreateOrUpdateGameplayEffectsFromSettings(bool bClearGameplayEffectFolderFirst, bool bForceFullUpdate)
+{
+	return CreateOrUpdateRowTypeAssets(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect), bClearGameplayEffectFolderFirst, bForceFullUpdate);
+}
+
+// ===================== Schema 导出实现 =====================
+
+namespace
+{
+	static void FillEnumInfo(UEnum* Enum, FString& OutEnumPath, TArray<FString>& OutEnumValues)
+	{
+		OutEnumPath.Reset();
+		OutEnumValues.Reset();
+		if (!Enum) return;
+
+		OutEnumPath = Enum->GetPathName();
+		const int32 Num = Enum->NumEnums();
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const FString NameString = Enum->GetNameStringByIndex(i);
+			if (NameString.EndsWith(TEXT("_MAX")))
+			{
+				continue;
+			}
+			OutEnumValues.Add(NameString);
+		}
+	}
+
+	static FString GetPropertyKind(const FProperty* Prop)
+	{
+		if (CastField<FBoolProperty>(Prop)) return TEXT("bool");
+		if (CastField<FIntProperty>(Prop) || CastField<FInt64Property>(Prop) || CastField<FUInt32Property>(Prop) || CastField<FUInt64Property>(Prop)) return TEXT("int");
+		if (CastField<FFloatProperty>(Prop)) return TEXT("float");
+		if (CastField<FDoubleProperty>(Prop)) return TEXT("double");
+		if (CastField<FStrProperty>(Prop)) return TEXT("string");
+		if (CastField<FNameProperty>(Prop)) return TEXT("name");
+		if (CastField<FTextProperty>(Prop)) return TEXT("text");
+		if (CastField<FEnumProperty>(Prop)) return TEXT("enum");
+
+		if (const FByteProperty* ByteProp = CastField<FByteProperty>(Prop))
+		{
+			if (ByteProp->Enum) return TEXT("enum");
+			return TEXT("int");
+		}
+		if (CastField<FStructProperty>(Prop)) return TEXT("struct");
+		if (CastField<FArrayProperty>(Prop)) return TEXT("array");
+		return TEXT("unknown");
+	}
+
+	static FString MakeStructSignatureHash(UScriptStruct* Struct)
+	{
+		if (!Struct) return TEXT("");
+
+		FString Sig;
+		for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		{
+			const FProperty* Prop = *It;
+			Sig += Prop->GetName();
+			Sig += TEXT(":");
+			Sig += Prop->GetClass()->GetName();
+			Sig += TEXT(";");
+		}
+		return FMD5::HashAnsiString(*Sig);
+	}
+
+	static FString GetPluginPythonSchemaDir()
+	{
+		FString BaseDir;
+
+#if WITH_EDITOR
+		if (IPluginManager::Get().FindPlugin(TEXT("AbilityEditorHelper")).IsValid())
+		{
+			BaseDir = IPluginManager::Get().FindPlugin(TEXT("AbilityEditorHelper"))->GetBaseDir();
+		}
+#endif
+		if (BaseDir.IsEmpty())
+		{
+			// 兜底：项目本地插件路径
+			BaseDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("Plugins/AbilityEditorHelper"));
+		}
+		return FPaths::Combine(BaseDir, TEXT("Content/Python/Schema"));
+	}
+
+	static bool EnsureDirectoryTree(const FString& Dir)
+	{
+		IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+		return PF.CreateDirectoryTree(*Dir);
+	}
+}
+
+bool UAbilityEditorHelperLibrary::WriteStructSchemaToJson(UScriptStruct* StructType, const FString& OutJsonFilePath, FString& OutError)
+{
+	OutError.Reset();
+	if (OutJsonFilePath.IsEmpty())
+	{
+		OutError = TEXT("StructPath 或 OutJsonFilePath 为空");
+		return false;
+	}
+
+	if (!StructType)
 	{
 		OutError = FString::Printf(TEXT("UScriptStruct为空"));
 		return false;
@@ -1285,6 +1803,35 @@ bool UAbilityEditorHelperLibrary::GenerateAllSchemasFromSettings(bool bClearSche
 	return bAllSuccess;
 }
 
+namespace
+{
+	/**
+	 * 按扩展名打开 JsonPath 下的数据文件：.aebin 为二进制行文件（校验行结构的 Schema Hash），其余按 JSON 读取
+	 * 两者都以内存映射方式直接读取文件的原始字节
+	 */
+	static TUniquePtr<FAbilityEditorRowSource> OpenJsonRowSource(const FString& FilePath, UScriptStruct* RowStruct, FString& OutError)
+	{
+		if (FAbilityEditorBinaryRowReader::IsBinaryRowFile(FilePath))
+		{
+			TUniquePtr<FAbilityEditorBinaryRowReader> BinaryReader = MakeUnique<FAbilityEditorBinaryRowReader>();
+			if (!BinaryReader->OpenFile(FilePath, MakeStructSignatureHash(RowStruct)))
+			{
+				OutError = FString::Printf(TEXT("二进制行文件读取失败：%s"), *BinaryReader->GetErrorMessage());
+				return nullptr;
+			}
+			return BinaryReader;
+		}
+
+		TUniquePtr<FAbilityEditorJsonRowReader> JsonReader = MakeUnique<FAbilityEditorJsonRowReader>();
+		if (!JsonReader->OpenFile(FilePath))
+		{
+			OutError = FString::Printf(TEXT("JSON 解析失败：%s"), *JsonReader->GetErrorMessage());
+			return nullptr;
+		}
+		return JsonReader;
+	}
+}
+
 bool UAbilityEditorHelperLibrary::ImportDataTableFromJsonFile(UDataTable* TargetDataTable, const FString& JsonFileName, bool bClearBeforeImport, int32& OutImportedRowCount, FString& OutError)
 {
 	OutError.Reset();
@@ -1302,6 +1849,13 @@ bool UAbilityEditorHelperLibrary::ImportDataTableFromJsonFile(UDataTable* Target
 		return false;
 	}
 
+	UScriptStruct* RowStruct = const_cast<UScriptStruct*>(TargetDataTable->GetRowStruct());
+	if (!RowStruct)
+	{
+		OutError = TEXT("TargetDataTable 未设置行结构");
+		return false;
+	}
+
 	// 从设置获取 JsonPath 并拼接完整路径
 	const UAbilityEditorHelperSettings* Settings = GetDefault<UAbilityEditorHelperSettings>();
 	if (!Settings || Settings->JsonPath.IsEmpty())
@@ -1318,25 +1872,64 @@ bool UAbilityEditorHelperLibrary::ImportDataTableFromJsonFile(UDataTable* Target
 		return false;
 	}
 
+	// 映射文件并逐行解析 UTF-8（不再经 LoadFileToString 转换为 UTF-16 字符串与 DOM）
+	TUniquePtr<FAbilityEditorRowSource> RowSource = OpenJsonRowSource(JsonFilePath, RowStruct, OutError);
+	if (!RowSource)
+	{
+		return false;
+	}
+
+	// 先读完并绑定全部行（暂存在竞技场中），文件有误时不改动 DataTable
+	const FAbilityEditorJsonRowBinder Binder(RowStruct);
+	FAbilityEditorRowArena RowArena(RowStruct);
+	TArray<TPair<FName, FAbilityEditorRowView>> ImportedRows;
+	FAbilityEditorJsonRow JsonRow;
+	while (RowSource->ReadNextRow(JsonRow))
+	{
+		if (JsonRow.Name.IsEmpty())
+		{
+			UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] JSON 条目缺少 Name 字段，已跳过"));
+			continue;
+		}
+
+		FAbilityEditorRowView RowData = RowArena.Allocate();
+		FString RowError;
+		if (!Binder.BindRow(JsonRow, RowData.Get(), RowError))
+		{
+			UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 无法反序列化行 %s，已跳过：%s"), *JsonRow.Name, *RowError);
+			RowArena.Release(RowData);
+			continue;
+		}
+		ImportedRows.Emplace(FName(*JsonRow.Name), RowData);
+	}
+
+	if (RowSource->HasError())
+	{
+		OutError = FString::Printf(TEXT("数据读取失败：%s"), *RowSource->GetErrorMessage());
+		return false;
+	}
+
 	// 可选：导入前清空旧数据
 	if (bClearBeforeImport)
 	{
 		TargetDataTable->EmptyTable();
 	}
 
-	// 调用引擎函数从 JSON 文件填充 DataTable
-	OutImportedRowCount = UDataTableFunctionLibrary::FillDataTableFromJSONFile(TargetDataTable, JsonFilePath);
-
-	const bool bSuccess = (OutImportedRowCount >= 0);
-
-#if WITH_EDITOR
-	if (bSuccess)
+	// 重复行名以最后一次出现为准
+	for (const TPair<FName, FAbilityEditorRowView>& ImportedRow : ImportedRows)
 	{
-		TargetDataTable->MarkPackageDirty();
+		TargetDataTable->AddRow(ImportedRow.Key, *reinterpret_cast<const FTableRowBase*>(ImportedRow.Value.Get()));
 	}
+	OutImportedRowCount = ImportedRows.Num();
+
+#if WITH_EDITOR
+	TargetDataTable->MarkPackageDirty();
 #endif
 
-	return bSuccess;
+	// DataTable 已被整体改写，旧的增量清单不再可信
+	FAbilityEditorImportManifest::Delete(TargetDataTable);
+
+	return true;
 }
 
 bool UAbilityEditorHelperLibrary::ParseAttributeString(const FString& AttributeString, FGameplayAttribute& OutAttribute)
@@ -1348,6 +1941,14 @@ bool UAbilityEditorHelperLibrary::ParseAttributeString(const FString& AttributeS
 		return false;
 	}
 
+	// 快速路径：索引中直接命中完整字符串
+	FAbilityEditorAttributeIndex& AttributeIndex = FAbilityEditorAttributeIndex::Get();
+	if (AttributeIndex.Find(AttributeString, OutAttribute))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[AbilityEditorHelper] 成功解析属性：%s"), *AttributeString);
+		return true;
+	}
+
 	// 支持两种格式：
 	// 1. 简化格式：ClassName.PropertyName（如 TestAttributeSet.TestPropertyOne）
 	// 2. 完整格式：/Script/Module.ClassName:PropertyName
@@ -1392,65 +1993,22 @@ bool UAbilityEditorHelperLibrary::ParseAttributeString(const FString& AttributeS
 		return false;
 	}
 
-	// 确保类名以 U 开头（UE 类命名规范）
-	FString FullClassName = ClassName;
-	if (!FullClassName.StartsWith(TEXT("U")))
+	// 按类名（带或不带 U 前缀）与属性名查找
+	if (AttributeIndex.Find(ClassName, PropertyName, OutAttribute))
 	{
-		FullClassName = TEXT("U") + ClassName;
-	}
-
-	// 只遍历 UAttributeSet 的派生类（性能优化）
-	UClass* FoundClass = nullptr;
-	TArray<UClass*> AttributeSetClasses;
-	GetDerivedClasses(UAttributeSet::StaticClass(), AttributeSetClasses, true);
-
-	for (UClass* Class : AttributeSetClasses)
-	{
-		if (!Class || Class->HasAnyClassFlags(CLASS_Abstract))
-		{
-			continue;
-		}
-
-		const FString CurrentClassName = Class->GetName();
-		// 比较类名（带U前缀或不带都支持）
-		if (CurrentClassName.Equals(FullClassName, ESearchCase::IgnoreCase) ||
-			CurrentClassName.Equals(ClassName, ESearchCase::IgnoreCase))
-		{
-			FoundClass = Class;
-			break;
-		}
+		UE_LOG(LogTemp, Verbose, TEXT("[AbilityEditorHelper] 成功解析属性：%s -> %s.%s"), *AttributeString, *ClassName, *PropertyName);
+		return true;
 	}
 
-	if (!FoundClass)
+	if (!AttributeIndex.HasAttributeSetClass(ClassName))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 无法找到 AttributeSet 类：%s"), *ClassName);
-		return false;
-	}
-
-	// 从类中查找属性
-	FProperty* FoundProperty = FoundClass->FindPropertyByName(FName(*PropertyName));
-	if (!FoundProperty)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 在类 %s 中无法找到属性：%s"), *FoundClass->GetName(), *PropertyName);
-		return false;
 	}
-
-	// 验证是 FGameplayAttributeData 类型的属性
-	const FStructProperty* StructProperty = CastField<FStructProperty>(FoundProperty);
-	if (!StructProperty || StructProperty->Struct != FGameplayAttributeData::StaticStruct())
+	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 属性 %s.%s 不是 FGameplayAttributeData 类型"),
-			*FoundClass->GetName(), *PropertyName);
-		return false;
+		UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 在类 %s 中无法找到 FGameplayAttributeData 类型的属性：%s"), *ClassName, *PropertyName);
 	}
-
-	// 构建 FGameplayAttribute
-	OutAttribute = FGameplayAttribute(FoundProperty);
-
-	UE_LOG(LogTemp, Log, TEXT("[AbilityEditorHelper] 成功解析属性：%s -> %s.%s"),
-		*AttributeString, *FoundClass->GetName(), *PropertyName);
-
-	return true;
+	return false;
 }
 
 // ===================== 增量更新实现 =====================
@@ -1458,335 +2016,766 @@ bool UAbilityEditorHelperLibrary::ParseAttributeString(const FString& AttributeS
 namespace
 {
 	/**
-	 * 将结构体序列化为 JSON 字符串（用于比较）
-	 * 支持 FGameplayEffectConfig 及其派生类
+	 * 单行 JSON 的解析结果（由工作线程填充）
 	 */
-	static FString SerializeStructToJsonString(UScriptStruct* StructType, const void* StructData)
-	{
-		FString JsonString;
-		if (FJsonObjectConverter::UStructToJsonObjectString(StructType, StructData, JsonString, 0, 0))
-		{
-			return JsonString;
-		}
-		return TEXT("");
-	}
+	struct FParsedJsonRow
+	{
+		FName RowName;
+		/** 变化行绑定后的新配置（位于导入的行竞技场中） */
+		FAbilityEditorRowView Row;
+		FString Error;
+		uint64 SourceHash = 0;
+		uint64 ConfigHash = 0;
+		bool bMissingName = false;
+		bool bValid = false;
+		bool bChanged = false;
+		bool bSkippedByManifest = false;
+	};
+
+	/** 每批读取的行数：批内并行绑定与比较，批与批之间只保留变化行的结构体 */
+	static constexpr int32 JsonRowBatchSize = 256;
 
 	/**
-	 * 比较两个结构体是否相同
-	 * 通过序列化为 JSON 字符串后比较来实现
+	 * 读取 DataTable 对应的增量清单，并初始化本次导入要写入的新清单
+	 * @return 是否存在有效的旧清单
 	 */
-	static bool AreStructsEqual(UScriptStruct* StructType, const void* A, const void* B)
+	static bool PrepareImportManifests(const UDataTable* DataTable, UScriptStruct* RowStruct, FAbilityEditorImportManifest& OutPrevious, FAbilityEditorImportManifest& OutNew)
 	{
-		const FString JsonA = SerializeStructToJsonString(StructType, A);
-		const FString JsonB = SerializeStructToJsonString(StructType, B);
-		return JsonA.Equals(JsonB);
-	}
-}
+		const FString SchemaHash = MakeStructSignatureHash(RowStruct);
+		const bool bHasPrevious = FAbilityEditorImportManifest::Load(DataTable, SchemaHash, OutPrevious);
 
-bool UAbilityEditorHelperLibrary::ImportAndUpdateGameplayEffectsFromJson(
-	const FString& JsonFileName,
-	bool bClearGameplayEffectFolderFirst,
-	TArray<FName>& OutUpdatedRowNames)
-{
-	OutUpdatedRowNames.Reset();
+		OutNew.ResetHeader(DataTable, SchemaHash);
 
-	const UAbilityEditorHelperSettings* Settings = nullptr;
-	UDataTable* DataTable = nullptr;
-	if (!GetSettingsAndDataTable(Settings, DataTable))
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("无法获取 Settings 或 DataTable"));
-		return false;
+		// 指纹包含 DataTable 内容哈希，导入改变了内容时旧指纹自然不再匹配，可直接沿用
+		OutNew.GenerationFingerprint = OutPrevious.GenerationFingerprint;
+		return bHasPrevious;
 	}
 
-	// 校验行结构（支持 FGameplayEffectConfig 及其派生类）
-	UScriptStruct* RowStruct = const_cast<UScriptStruct*>(DataTable->GetRowStruct());
-	if (!RowStruct || !RowStruct->IsChildOf(FGameplayEffectConfig::StaticStruct()))
+	/**
+	 * 流式读取数据行（JSON 或 xlsx / CSV）并与现有 DataTable 比较，找出新增或变化的行
+	 * - 构造时（游戏线程）对 DataTable 现有行的内容哈希做快照；之后的数据阶段只与快照比较，不访问 DataTable，可在工作线程执行
+	 * - Token 按批读取，批内逐行绑定/哈希并行执行
+	 * - 源数据哈希与旧清单一致、且 DataTable 中该行的内容哈希仍等于清单记录的配置哈希时直接跳过，不绑定结构体
+	 *   （DataTable 修改后未保存就关闭编辑器时，磁盘上的行与清单不符，该行会重新处理）
+	 * - 其余行绑定后与快照中的内容哈希比较
+	 * - 字段级变化与"是否新增"需要读取现有行，由 CollectRowChanges 在游戏线程上生成
+	 * 未变化的行在比较后立即释放，常驻内存只与变化行数量相关
+	 * 每次 ProcessNextBatch 处理一批，异步导入可在批与批之间取消
+	 */
+	class FJsonRowDiff
 	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("DataTable 行结构不是 FGameplayEffectConfig 或其派生类"));
-		return false;
-	}
+	public:
+		/**
+		 * @param RowArena          暂存新配置的竞技场（由导入任务持有，比较结束后仍需保留变化行）
+		 * @param PreviousManifest  上次导入的清单（可为空）
+		 * @param OutManifest       本次导入的清单
+		 */
+		FJsonRowDiff(UScriptStruct* InRowStruct, const UDataTable* DataTable, FAbilityEditorRowSource& InRowReader, FAbilityEditorRowArena& InRowArena,
+			const FAbilityEditorImportManifest* InPreviousManifest, FAbilityEditorImportManifest& OutManifest)
+			: RowStruct(InRowStruct)
+			, RowReader(InRowReader)
+			, RowArena(InRowArena)
+			, PreviousManifest(InPreviousManifest)
+			, Manifest(OutManifest)
+			, Binder(InRowStruct)
+			, bManifestDirty(InPreviousManifest == nullptr)
+		{
+			check(IsInGameThread());
+			ExistingRowHashes.Reserve(DataTable->GetRowMap().Num());
+			for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
+			{
+				ExistingRowHashes.Add(RowPair.Key, FAbilityEditorStructHash::HashStruct(RowStruct, RowPair.Value));
+			}
+		}
 
-	const int32 StructSize = RowStruct->GetStructureSize();
+		/** 含硬引用对象属性的行结构在绑定时可能加载资产，只能在游戏线程串行执行 */
+		bool RequiresGameThread() const { return Binder.RequiresGameThread(); }
 
-	// 构建 JSON 文件完整路径
-	if (Settings->JsonPath.IsEmpty())
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("UAbilityEditorHelperSettings 的 JsonPath 未配置"));
-		return false;
-	}
-	const FString JsonFilePath = FPaths::Combine(Settings->JsonPath, JsonFileName);
+		/** 新清单是否与旧清单不同（需要写回） */
+		bool IsManifestDirty() const { return bManifestDirty; }
 
-	if (!FPaths::FileExists(JsonFilePath))
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("JSON 文件不存在：%s"), *JsonFilePath);
-		return false;
-	}
+		/**
+		 * 读取并比较下一批行
+		 * @return 数据读取失败（格式错误等）时返回 Failed，读完全部行后返回 Done
+		 */
+		EAbilityEditorImportStepResult ProcessNextBatch()
+		{
+			const EParallelForFlags BindFlags = Binder.RequiresGameThread() ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
 
-	// 读取 JSON 文件内容
-	FString JsonContent;
-	if (!FFileHelper::LoadFileToString(JsonContent, *JsonFilePath))
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("无法读取 JSON 文件：%s"), *JsonFilePath);
-		return false;
-	}
+			// 串行读取一批行的 Token
+			bool bEndOfInput = false;
+			RowBatch.SetNum(JsonRowBatchSize, EAllowShrinking::No);
+			int32 BatchCount = 0;
+			while (BatchCount < JsonRowBatchSize)
+			{
+				if (!RowReader.ReadNextRow(RowBatch[BatchCount]))
+				{
+					bEndOfInput = true;
+					break;
+				}
+				++BatchCount;
+			}
 
-	// 解析 JSON 为数组
-	TArray<TSharedPtr<FJsonValue>> JsonArray;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonContent);
-	if (!FJsonSerializer::Deserialize(Reader, JsonArray))
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("JSON 解析失败，格式不正确"));
-		return false;
-	}
+			if (RowReader.HasError())
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 数据读取失败：%s"), *RowReader.GetErrorMessage());
+				return EAbilityEditorImportStepResult::Failed;
+			}
 
-	// 缓存现有 DataTable 数据的 JSON 表示（用于比较）
-	TMap<FName, FString> ExistingJsonMap;
-	for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
-	{
-		if (RowPair.Value)
-		{
-			FString JsonStr = SerializeStructToJsonString(RowStruct, RowPair.Value);
-			ExistingJsonMap.Add(RowPair.Key, JsonStr);
-		}
-	}
+			// 并行绑定新配置并与现有行的哈希快照比较（快照与旧清单此时只读）
+			ParsedRows.Reset();
+			ParsedRows.SetNum(BatchCount);
+			ParallelFor(BatchCount, [&](int32 Index)
+			{
+				const FAbilityEditorJsonRow& JsonRow = RowBatch[Index];
+				FParsedJsonRow& Parsed = ParsedRows[Index];
 
-	// 使用动态内存分配存储新配置数据
-	TMap<FName, TSharedPtr<uint8, ESPMode::ThreadSafe>> NewConfigsMemory;
-	TMap<FName, FString> NewJsonMap;
+				// 获取行名（Name 字段）
+				if (JsonRow.Name.IsEmpty())
+				{
+					Parsed.bMissingName = true;
+					return;
+				}
+				Parsed.RowName = FName(*JsonRow.Name);
+				Parsed.SourceHash = JsonRow.ComputeSourceHash();
 
-	for (const TSharedPtr<FJsonValue>& JsonValue : JsonArray)
-	{
-		if (!JsonValue.IsValid() || JsonValue->Type != EJson::Object)
-		{
-			continue;
-		}
+				const uint64* ExistingHash = ExistingRowHashes.Find(Parsed.RowName);
 
-		const TSharedPtr<FJsonObject>& JsonObject = JsonValue->AsObject();
-		if (!JsonObject.IsValid())
-		{
-			continue;
+				// 源数据与上次导入一致，且 DataTable 中的行仍是上次导入写入的内容：直接沿用清单记录
+				const FAbilityEditorManifestRow* PreviousRow = PreviousManifest ? PreviousManifest->FindRow(Parsed.RowName) : nullptr;
+				if (PreviousRow && ExistingHash
+					&& FAbilityEditorImportManifest::StringToHash(PreviousRow->SourceHash) == Parsed.SourceHash
+					&& FAbilityEditorImportManifest::StringToHash(PreviousRow->ConfigHash) == *ExistingHash)
+				{
+					Parsed.ConfigHash = *ExistingHash;
+					Parsed.bSkippedByManifest = true;
+					Parsed.bValid = true;
+					return;
+				}
+
+				// 从竞技场取一行（已初始化为默认值），直接从 Token 绑定为实际的结构体类型
+				FAbilityEditorRowView ConfigRow = RowArena.Allocate();
+				if (!Binder.BindRow(JsonRow, ConfigRow.Get(), Parsed.Error))
+				{
+					RowArena.Release(ConfigRow);
+					return;
+				}
+
+				// 计算内容哈希并与现有行的快照比较
+				Parsed.ConfigHash = FAbilityEditorStructHash::HashStruct(RowStruct, ConfigRow.Get());
+				Parsed.bChanged = !ExistingHash || *ExistingHash != Parsed.ConfigHash;
+				Parsed.bValid = true;
+				if (!Parsed.bChanged)
+				{
+					// 未变化的行不再需要，立即归还槽位供后续行复用
+					RowArena.Release(ConfigRow);
+					return;
+				}
+				Parsed.Row = ConfigRow;
+			}, BindFlags);
+
+			// 串行汇总：保持 JSON 中的行顺序，日志也在此统一输出
+			for (FParsedJsonRow& Parsed : ParsedRows)
+			{
+				if (Parsed.bMissingName)
+				{
+					UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] JSON 条目缺少 Name 字段，已跳过"));
+					continue;
+				}
+
+				// 无法反序列化的行仍在数据源中，不视为已删除
+				SeenRowNames.Add(Parsed.RowName);
+				if (!Parsed.bValid)
+				{
+					UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 无法反序列化行 %s，已跳过：%s"), *Parsed.RowName.ToString(), *Parsed.Error);
+					continue;
+				}
+
+				// 记录清单
+				FAbilityEditorManifestRow& ManifestRow = Manifest.FindOrAddRow(Parsed.RowName);
+				ManifestRow.SourceHash = FAbilityEditorImportManifest::HashToString(Parsed.SourceHash);
+				ManifestRow.ConfigHash = FAbilityEditorImportManifest::HashToString(Parsed.ConfigHash);
+
+				if (Parsed.bSkippedByManifest)
+				{
+					++SkippedByManifestCount;
+				}
+				else
+				{
+					bManifestDirty = true;
+				}
+
+				if (!Parsed.bChanged)
+				{
+					// 重复行名以最后一次出现为准：后出现的未变化行覆盖先前记录的变化
+					if (UpdatedRowSet.Remove(Parsed.RowName) > 0)
+					{
+						UpdatedRowNames.Remove(Parsed.RowName);
+						FAbilityEditorRowView SupersededRow;
+						if (NewConfigs.RemoveAndCopyValue(Parsed.RowName, SupersededRow))
+						{
+							RowArena.Release(SupersededRow);
+						}
+					}
+					continue;
+				}
+
+				FAbilityEditorRowView& StagedRow = NewConfigs.FindOrAdd(Parsed.RowName);
+				RowArena.Release(StagedRow);
+				StagedRow = Parsed.Row;
+
+				if (!UpdatedRowSet.Contains(Parsed.RowName))
+				{
+					// 新增或变化的行
+					UpdatedRowSet.Add(Parsed.RowName);
+					UpdatedRowNames.Add(Parsed.RowName);
+					UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 检测到变化的行：%s"), *Parsed.RowName.ToString());
+				}
+			}
+
+			if (!bEndOfInput)
+			{
+				return EAbilityEditorImportStepResult::Continue;
+			}
+
+			if (PreviousManifest && PreviousManifest->Rows.Num() != Manifest.Rows.Num())
+			{
+				bManifestDirty = true;
+			}
+
+			// 上次导入记录过、DataTable 中仍有、数据源中已没有的行
+			// 只认定清单中的行：在编辑器中手动添加的行从未来自数据源，不视为已删除；数据源为空时视为导出异常，不认定任何行被删除
+			if (PreviousManifest && SeenRowNames.Num() > 0)
+			{
+				for (const TPair<FName, uint64>& ExistingRow : ExistingRowHashes)
+				{
+					if (!SeenRowNames.Contains(ExistingRow.Key) && PreviousManifest->FindRow(ExistingRow.Key))
+					{
+						RemovedRowNames.Add(ExistingRow.Key);
+					}
+				}
+			}
+			SeenRowNames.Empty();
+			ExistingRowHashes.Empty();
+
+			if (SkippedByManifestCount > 0)
+			{
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 增量清单命中 %d 行，已跳过解析"), SkippedByManifestCount);
+			}
+			return EAbilityEditorImportStepResult::Done;
 		}
 
-		// 获取行名（Name 字段）
-		FString RowNameStr;
-		if (!JsonObject->TryGetStringField(TEXT("Name"), RowNameStr) || RowNameStr.IsEmpty())
+		/**
+		 * 生成变化行的字段级变化（游戏线程，须在新配置写入 DataTable 之前调用）
+		 * 数据阶段不读取 DataTable 行内存，"是否新增"与逐字段比较都在这里完成
+		 */
+		void CollectRowChanges(const UDataTable* DataTable)
 		{
-			UE_LOG(LogAbilityEditor, Warning, TEXT("JSON 条目缺少 Name 字段，已跳过"));
-			continue;
-		}
+			check(IsInGameThread());
+			RowChanges.Reset();
+			RowChanges.Reserve(UpdatedRowNames.Num());
+			for (const FName& RowName : UpdatedRowNames)
+			{
+				FAbilityEditorImportRowChange& RowChange = RowChanges.Add(RowName);
+				RowChange.RowName = RowName;
 
-		// 分配内存并初始化结构体
-		TSharedPtr<uint8, ESPMode::ThreadSafe> ConfigMemory(
-			static_cast<uint8*>(FMemory::Malloc(StructSize)),
-			[](uint8* Ptr) { FMemory::Free(Ptr); }
-		);
-		RowStruct->InitializeStruct(ConfigMemory.Get());
+				const uint8* ExistingRowData = DataTable->FindRowUnchecked(RowName);
+				RowChange.bAdded = ExistingRowData == nullptr;
 
-		// 反序列化为实际的结构体类型
-		if (!FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), RowStruct, ConfigMemory.Get()))
-		{
-			UE_LOG(LogAbilityEditor, Warning, TEXT("无法反序列化行 %s，已跳过"), *RowNameStr);
-			RowStruct->DestroyStruct(ConfigMemory.Get());
-			continue;
+				const FAbilityEditorRowView* NewConfigRow = NewConfigs.Find(RowName);
+				if (ExistingRowData && NewConfigRow && NewConfigRow->IsValid())
+				{
+					FAbilityEditorStructDiff::CollectChangedFields(RowStruct, ExistingRowData, NewConfigRow->Get(), RowChange.Fields);
+				}
+			}
 		}
 
-		FName RowName(*RowNameStr);
-		NewConfigsMemory.Add(RowName, ConfigMemory);
+		/** 新增或变化的行（行名 -> 竞技场中的结构体），重复行名以最后一次出现为准 */
+		TMap<FName, FAbilityEditorRowView> NewConfigs;
 
-		// 序列化为 JSON 字符串用于比较
-		FString NewJsonStr = SerializeStructToJsonString(RowStruct, ConfigMemory.Get());
-		NewJsonMap.Add(RowName, NewJsonStr);
+		/** 新增或变化的行名（保持 JSON 中的出现顺序） */
+		TArray<FName> UpdatedRowNames;
 
-		// 比较是否有变化
-		const FString* ExistingJson = ExistingJsonMap.Find(RowName);
-		if (!ExistingJson || !ExistingJson->Equals(NewJsonStr))
-		{
-			// 新增或变化的行
-			OutUpdatedRowNames.Add(RowName);
-			UE_LOG(LogAbilityEditor, Log, TEXT("检测到变化的行：%s"), *RowNameStr);
-		}
-	}
+		/** 新增或变化的行 -> 字段级变化（用于导入报告，由 CollectRowChanges 填写） */
+		TMap<FName, FAbilityEditorImportRowChange> RowChanges;
 
-	// 如果没有变化，直接返回
-	if (OutUpdatedRowNames.Num() == 0)
-	{
-		UE_LOG(LogAbilityEditor, Log, TEXT("未检测到任何数据变化，无需更新"));
-		return true;
-	}
+		/** 上次导入的清单中有、DataTable 中存在、但数据源中已不存在的行（读完全部行后计算） */
+		TArray<FName> RemovedRowNames;
 
-	UE_LOG(LogAbilityEditor, Log, TEXT("共检测到 %d 行数据变化"), OutUpdatedRowNames.Num());
+	private:
+		UScriptStruct* RowStruct = nullptr;
+		FAbilityEditorRowSource& RowReader;
+		FAbilityEditorRowArena& RowArena;
+		const FAbilityEditorImportManifest* PreviousManifest = nullptr;
+		FAbilityEditorImportManifest& Manifest;
+		const FAbilityEditorJsonRowBinder Binder;
 
-#if WITH_EDITOR
-	// 更新 DataTable 中变化的行
-	for (const FName& RowName : OutUpdatedRowNames)
+		TArray<FAbilityEditorJsonRow> RowBatch;
+		TArray<FParsedJsonRow> ParsedRows;
+		TSet<FName> UpdatedRowSet;
+		/** 构造时 DataTable 现有行的内容哈希快照（行名 -> 哈希），读完全部行后释放 */
+		TMap<FName, uint64> ExistingRowHashes;
+		/** 数据源中出现过的行名（含无法反序列化的行） */
+		TSet<FName> SeenRowNames;
+		int32 SkippedByManifestCount = 0;
+		bool bManifestDirty = false;
+	};
+
+	/** 增量导入的数据来源 */
+	enum class EIncrementalImportSource : uint8
 	{
-		TSharedPtr<uint8, ESPMode::ThreadSafe>* NewConfigMemory = NewConfigsMemory.Find(RowName);
-		if (!NewConfigMemory || !NewConfigMemory->IsValid())
+		/** JsonPath 下的 JSON 文件 */
+		Json,
+		/** ExcelPath 下的 xlsx 工作簿或 CSV 目录（原生读取，不经过 Python 与中间 JSON） */
+		Spreadsheet,
+	};
+
+	/**
+	 * 增量导入：数据阶段逐批比较源数据与 DataTable，资产阶段只对新增或变化的行各执行一个步骤
+	 * 取消时未处理的行在 DataTable 中还原为导入前的内容，且不记录源数据哈希，下次导入时重新处理
+	 */
+	class FIncrementalImportJob : public FAbilityEditorImportJob
+	{
+	public:
+		FIncrementalImportJob(const FGenerationTargetInfo& InInfo, EIncrementalImportSource InSource, const FString& InSourceFileName, bool bInClearFolderFirst)
+			: Info(InInfo)
+			, Source(InSource)
+			, SourceFileName(InSourceFileName)
+			, bClearFolderFirst(bInClearFolderFirst)
 		{
-			continue;
 		}
 
-		// 检查行是否存在
-		uint8* ExistingRowData = DataTable->FindRowUnchecked(RowName);
-		if (ExistingRowData)
+		virtual FText GetDisplayName() const override
 		{
-			// 更新现有行（复制结构体数据）
-			RowStruct->CopyScriptStruct(ExistingRowData, NewConfigMemory->Get());
+			return FText::Format(NSLOCTEXT("AbilityEditorHelper", "JsonImportJob", "从 {0} 导入 {1}"), FText::FromString(SourceFileName), FText::FromString(Info.GetTypeName()));
 		}
-		else
+
+		virtual bool Prepare(bool& bOutSuccess) override
 		{
-			// 添加新行
-			DataTable->AddRow(RowName, *reinterpret_cast<FTableRowBase*>(NewConfigMemory->Get()));
-		}
-	}
+			bOutSuccess = false;
+			if (!Info.bValid)
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 无法获取 Settings 或 DataTable"));
+				return false;
+			}
 
-	DataTable->MarkPackageDirty();
+			// 校验行结构
+			RowStruct = const_cast<UScriptStruct*>(Info.DataTable->GetRowStruct());
+			if (!Info.HasExpectedRowStruct())
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] DataTable 行结构不是 %s 或其派生类"), *Info.GetExpectedRowStruct()->GetName());
+				return false;
+			}
 
-	// 规范化基础路径
-	FString BasePath = GetGameplayEffectBasePath(Settings);
+			if (!OpenRowSource())
+			{
+				return false;
+			}
 
-	// 可选：清理不在 DataTable 中的 GE 资产
-	if (bClearGameplayEffectFolderFirst)
-	{
-		CleanupGameplayEffectFolder(BasePath, DataTable);
-	}
+			// 读取增量清单：源数据未变化的行无需解析
+			const bool bHasPreviousManifest = PrepareImportManifests(Info.DataTable, RowStruct, PreviousManifest, NewManifest);
+			RowArena.Emplace(RowStruct);
+			Diff.Emplace(RowStruct, Info.DataTable, *RowSource, *RowArena, bHasPreviousManifest ? &PreviousManifest : nullptr, NewManifest);
+			return true;
+		}
 
-	// 只对变化的行创建/更新 GameplayEffect
-	int32 SuccessCount = 0;
-	int32 FailCount = 0;
-	for (const FName& RowName : OutUpdatedRowNames)
-	{
-		// 从 DataTable 获取更新后的配置
-		uint8* ConfigData = DataTable->FindRowUnchecked(RowName);
-		if (!ConfigData)
+		virtual bool CanRunDataStageOffGameThread() const override
 		{
-			continue;
+			return Diff.IsSet() && !Diff->RequiresGameThread();
 		}
-		const FGameplayEffectConfig* Config = reinterpret_cast<const FGameplayEffectConfig*>(ConfigData);
 
-		FString RowAssetName = RowName.ToString();
-		if (!RowAssetName.Contains(TEXT("GE_")))
+		virtual EAbilityEditorImportStepResult ExecuteDataStep() override
 		{
-			RowAssetName = TEXT("GE_") + RowAssetName;
+			return Diff->ProcessNextBatch();
 		}
-		const FString GEPath = FString::Printf(TEXT("%s/%s"), *BasePath, *RowAssetName);
 
-		bool bOK = false;
-		UGameplayEffect* GE = CreateOrImportGameplayEffect(GEPath, *Config, bOK);
-		if (bOK && GE)
+		virtual bool BeginAssetStage() override
 		{
-			UE_LOG(LogTemp, Log, TEXT("[AbilityEditorHelper] 成功创建/更新 GameplayEffect：%s"), *GEPath);
-			++SuccessCount;
+			if (Diff->UpdatedRowNames.Num() == 0)
+			{
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 未检测到任何数据变化，无需更新"));
+				return true;
+			}
+
+			UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 共检测到 %d 行数据变化"), Diff->UpdatedRowNames.Num());
+
+#if WITH_EDITOR
+			// 写入前与现有行比较，生成字段级变化报告
+			Diff->CollectRowChanges(Info.DataTable);
+
+			// 更新 DataTable（可取消时保留原有内容，用于还原未处理的行）
+			for (const FName& RowName : Diff->UpdatedRowNames)
+			{
+				FAbilityEditorRowView* NewConfigRow = Diff->NewConfigs.Find(RowName);
+				if (!NewConfigRow || !NewConfigRow->IsValid())
+				{
+					continue;
+				}
+
+				uint8* ExistingRowData = Info.DataTable->FindRowUnchecked(RowName);
+				if (ExistingRowData)
+				{
+					if (bCancellable)
+					{
+						PreviousRows.Add(RowName, RowArena->AllocateCopy(ExistingRowData));
+					}
+					RowStruct->CopyScriptStruct(ExistingRowData, NewConfigRow->Get());
+				}
+				else
+				{
+					Info.DataTable->AddRow(RowName, *reinterpret_cast<FTableRowBase*>(NewConfigRow->Get()));
+					if (bCancellable)
+					{
+						PreviousRows.Add(RowName, FAbilityEditorRowView());
+					}
+				}
+			}
+
+			// 新配置已写入 DataTable，归还其槽位
+			for (TPair<FName, FAbilityEditorRowView>& Pair : Diff->NewConfigs)
+			{
+				RowArena->Release(Pair.Value);
+			}
+			Diff->NewConfigs.Empty();
+			FAbilityEditorBulkImportScope::MarkPackageDirty(Info.DataTable);
+
+			// 可选：清理不在 DataTable 中的资产
+			if (bClearFolderFirst)
+			{
+				Info.CleanupFolder();
+			}
+
+			StampContext.Emplace(Info.Settings, Info.DataTable, true);
+			return true;
+#else
+			UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 此功能仅在编辑器环境下可用"));
+			return false;
+#endif
 		}
-		else
+
+		virtual int32 GetNumAssetSteps() const override
 		{
-			UE_LOG(LogTemp, Error, TEXT("[AbilityEditorHelper] 创建/更新失败：%s"), *GEPath);
-			++FailCount;
+			return StampContext.IsSet() ? Diff->UpdatedRowNames.Num() : 0;
 		}
-	}
 
-	UE_LOG(LogTemp, Log, TEXT("[AbilityEditorHelper] 增量更新完成：成功 %d 个，失败 %d 个"), SuccessCount, FailCount);
+		/** 只对变化的行创建/更新资产（同时写入配置印记，供之后的批量生成跳过） */
+		virtual void ExecuteAssetStep(int32 StepIndex) override
+		{
+			const FName RowName = Diff->UpdatedRowNames[StepIndex];
 
-	return FailCount == 0;
-#else
-	OutError = TEXT("此功能仅在编辑器环境下可用");
-	return false;
-#endif
-}
+			// 从 DataTable 获取更新后的配置
+			uint8* ConfigData = Info.DataTable->FindRowUnchecked(RowName);
+			if (!ConfigData)
+			{
+				return;
+			}
 
-// ===========================================
-// GameplayAbility 相关函数实现
-// ===========================================
+			const FString AssetPath = MakeRowAssetPath(Info.BasePath, RowName, Info.GetPrefix());
+			const int32 UnresolvedBefore = GUnresolvedReferenceCount;
+			if (UObject* Asset = Info.ApplyRow(AssetPath, ConfigData))
+			{
+				FRowStampContext::Apply(Asset, FAbilityEditorAssetStamp::Make(StampContext->ContextHash, RowStruct, ConfigData), Info.DataTable, RowName, UnresolvedBefore);
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 成功创建/更新 %s：%s"), Info.GetTypeName(), *AssetPath);
+				++SuccessCount;
+			}
+			else
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 创建/更新失败：%s"), *AssetPath);
+				// 失败的行不记录源数据哈希，下次导入时重新处理
+				NewManifest.FindOrAddRow(RowName).SourceHash.Reset();
+				++FailCount;
+			}
+		}
 
-bool UAbilityEditorHelperLibrary::GetGASettingsAndDataTable(const UAbilityEditorHelperSettings*& OutSettings, UDataTable*& OutDataTable)
-{
-	OutSettings = GetDefault<UAbilityEditorHelperSettings>();
-	if (!OutSettings)
-	{
-		UE_LOG(LogAbilityEditor, Warning, TEXT("无法获取 UAbilityEditorHelperSettings"));
-		return false;
-	}
+		virtual bool Finish(FAbilityEditorBulkImportScope& Scope, int32 NumStepsDone) override
+		{
+			const int32 NumSteps = GetNumAssetSteps();
 
-	OutDataTable = OutSettings->GameplayAbilityDataTable.IsValid()
-		? OutSettings->GameplayAbilityDataTable.Get()
-		: OutSettings->GameplayAbilityDataTable.LoadSynchronous();
+			// 取消：未处理的行还原 DataTable 内容，且不记录源数据哈希
+			const bool bCancelled = NumStepsDone < NumSteps;
+			for (int32 StepIndex = NumStepsDone; StepIndex < NumSteps; ++StepIndex)
+			{
+				const FName RowName = Diff->UpdatedRowNames[StepIndex];
+				NewManifest.FindOrAddRow(RowName).SourceHash.Reset();
 
-	if (!OutDataTable)
-	{
-		UE_LOG(LogAbilityEditor, Warning, TEXT("GameplayAbilityDataTable 未配置或加载失败"));
-		return false;
-	}
+				const FAbilityEditorRowView* PreviousRow = PreviousRows.Find(RowName);
+				if (!PreviousRow)
+				{
+					continue;
+				}
+				if (!PreviousRow->IsValid())
+				{
+					Info.DataTable->RemoveRow(RowName);
+				}
+				else if (uint8* RowData = Info.DataTable->FindRowUnchecked(RowName))
+				{
+					RowStruct->CopyScriptStruct(RowData, PreviousRow->Get());
+				}
+			}
 
-	return true;
-}
+			// 导入结束：一次性析构并释放全部暂存的行
+			PreviousRows.Empty();
+			RowArena->Reset();
 
-FString UAbilityEditorHelperLibrary::GetGameplayAbilityBasePath(const UAbilityEditorHelperSettings* Settings)
-{
-	if (!Settings || Settings->GameplayAbilityPath.IsEmpty())
-	{
-		return TEXT("/Game/Abilities/Abilities");
-	}
+			// 可选：删除数据源中已不存在的行及其生成的资产（取消时不删除）
+			const bool bDeletedRows = !bCancelled && DeleteRemovedRows();
 
-	FString BasePath = Settings->GameplayAbilityPath;
-	if (!BasePath.StartsWith(TEXT("/")))
-	{
-		BasePath = TEXT("/Game/") + BasePath;
-	}
-	BasePath.RemoveFromEnd(TEXT("/"));
-	return BasePath;
-}
+			if (NumSteps == 0 && !bDeletedRows)
+			{
+				if (Diff->IsManifestDirty())
+				{
+					NewManifest.Save(Info.DataTable);
+				}
+				SaveImportReport(0, false);
+				return true;
+			}
 
-void UAbilityEditorHelperLibrary::CleanupGameplayAbilityFolder(const FString& BasePath, const UDataTable* DataTable)
-{
-#if WITH_EDITOR
-	if (!DataTable)
-	{
-		return;
-	}
+			// 可选：保存本次新建或变化的包（含 DataTable）
+			bool bSaved = true;
+			if (Info.Settings->bSaveChangedPackagesAfterImport && Scope.IsRootScope())
+			{
+				bSaved = Scope.SaveTouchedPackages();
+				if (!bSaved)
+				{
+					++FailCount;
+				}
+			}
 
-	// 收集 DataTable 中的所有行名（带 GA_ 前缀）
-	TSet<FString> ValidAssetNames;
-	for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
-	{
-		FString RowAssetName = RowPair.Key.ToString();
-		if (!RowAssetName.Contains(TEXT("GA_")))
+			// 写回增量清单（保存失败时保留旧清单，下次导入重新比较这些行）与字段变化报告
+			if (bSaved)
+			{
+				NewManifest.Save(Info.DataTable);
+			}
+			SaveImportReport(NumStepsDone, bCancelled);
+
+			if (bCancelled)
+			{
+				UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] %s 增量更新已取消：已处理 %d / %d 行，成功 %d 个，失败 %d 个"),
+					Info.GetTypeName(), NumStepsDone, NumSteps, SuccessCount, FailCount);
+				return false;
+			}
+
+			UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] %s 增量更新完成：成功 %d 个，失败 %d 个"), Info.GetTypeName(), SuccessCount, FailCount);
+			return FailCount == 0;
+		}
+
+		virtual TArray<FName> GetUpdatedRowNames() const override
 		{
-			RowAssetName = TEXT("GA_") + RowAssetName;
+			return Diff.IsSet() ? Diff->UpdatedRowNames : TArray<FName>();
 		}
-		ValidAssetNames.Add(RowAssetName);
-	}
 
-	// 扫描目录下的蓝图资产
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+		virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+		{
+			Collector.AddReferencedObject(Info.DataTable);
+		}
 
-	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAssetsByPath(FName(*BasePath), AssetDataList, true);
+		virtual FString GetReferencerName() const override
+		{
+			return TEXT("FIncrementalImportJob");
+		}
 
-	TArray<UObject*> ToDelete;
-	for (const FAssetData& AssetData : AssetDataList)
-	{
-		if (AssetData.AssetClassPath == UBlueprint::StaticClass()->GetClassPathName())
+	private:
+		/**
+		 * 删除数据源中已不存在的行，以及由这些行生成的 GE/GA 资产（Settings::bDeleteRowsRemovedFromSource）
+		 * 按行名直接定位资产并校验来源标签，不扫描输出目录，耗时只与删除的行数有关
+		 * 仍被其他资产引用的生成资产不删除（只移除行并输出警告）；删除经由编辑器删除流程，启用源码管理时标记为删除
+		 * @return 是否删除了任何行
+		 */
+		bool DeleteRemovedRows()
 		{
-			FString AssetName = AssetData.AssetName.ToString();
-			if (!ValidAssetNames.Contains(AssetName))
+#if WITH_EDITOR
+			if (!Info.Settings->bDeleteRowsRemovedFromSource || Diff->RemovedRowNames.Num() == 0)
+			{
+				return false;
+			}
+
+			IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+			const FString DataTablePath = Info.DataTable->GetPathName();
+
+			// 由被删除的行生成的资产
+			TArray<FAssetData> GeneratedAssets;
+			TSet<FName> GeneratedPackageNames;
+			FString PackageName, AssetName, ObjectPath;
+			FString SourceTable;
+			FName SourceRow;
+			FString Stamp;
+			for (const FName& RowName : Diff->RemovedRowNames)
 			{
+				if (ParseAssetPath(MakeRowAssetPath(Info.BasePath, RowName, Info.GetPrefix()), PackageName, AssetName, ObjectPath))
+				{
+					// 带来源标签的资产只在来源为该行时删除；无标签的旧资产按命名规则认定
+					const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath));
+					const bool bGeneratedFromRow = AssetData.IsValid()
+						&& (!FAbilityEditorAssetStamp::ReadFromAssetData(AssetData, SourceTable, SourceRow, Stamp)
+							|| (SourceTable == DataTablePath && SourceRow == RowName));
+					if (bGeneratedFromRow)
+					{
+						GeneratedAssets.Add(AssetData);
+						GeneratedPackageNames.Add(AssetData.PackageName);
+					}
+				}
+
+				Info.DataTable->RemoveRow(RowName);
+				DeletedRowNames.Add(RowName);
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 数据源中已删除的行：%s"), *RowName.ToString());
+			}
+			FAbilityEditorBulkImportScope::MarkPackageDirty(Info.DataTable);
+
+			// 仍被本次删除范围之外的资产引用的资产保留
+			TArray<UObject*> AssetsToDelete;
+			TArray<FName> Referencers;
+			for (const FAssetData& AssetData : GeneratedAssets)
+			{
+				Referencers.Reset();
+				AssetRegistry.GetReferencers(AssetData.PackageName, Referencers, UE::AssetRegistry::EDependencyCategory::Package);
+				const FName* ExternalReferencer = Referencers.FindByPredicate([&GeneratedPackageNames](FName Referencer)
+				{
+					return !GeneratedPackageNames.Contains(Referencer);
+				});
+				if (ExternalReferencer)
+				{
+					UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] %s 仍被 %s 引用，未删除，请移除引用后手动删除"),
+						*AssetData.PackageName.ToString(), *ExternalReferencer->ToString());
+					continue;
+				}
+
 				if (UObject* Asset = AssetData.GetAsset())
 				{
-					ToDelete.Add(Asset);
-					UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 清理不在 DataTable 中的 GA 资产：%s"), *AssetName);
+					AssetsToDelete.Add(Asset);
 				}
 			}
+
+			const int32 NumDeletedAssets = AssetsToDelete.Num() > 0 ? ObjectTools::DeleteObjects(AssetsToDelete, /*bShowConfirmation*/ false) : 0;
+			UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] %s 已删除 %d 行及 %d 个生成的资产（保留 %d 个）"),
+				Info.GetTypeName(), DeletedRowNames.Num(), NumDeletedAssets, GeneratedAssets.Num() - NumDeletedAssets);
+			return true;
+#else
+			return false;
+#endif
 		}
-	}
 
-	if (ToDelete.Num() > 0)
-	{
-		ObjectTools::DeleteObjectsUnchecked(ToDelete);
-	}
-#endif
+		/** 写入字段级变化报告（只含前 NumAppliedRows 个已写入 DataTable 的变化行） */
+		void SaveImportReport(int32 NumAppliedRows, bool bCancelled) const
+		{
+			FAbilityEditorImportReport Report;
+			Report.DataTablePath = Info.DataTable->GetPathName();
+			Report.Source = SourceFileName;
+			Report.Time = FDateTime::UtcNow().ToIso8601();
+			Report.bCancelled = bCancelled;
+			Report.RemovedRows = DeletedRowNames;
+			Report.Rows.Reserve(NumAppliedRows);
+			for (int32 Index = 0; Index < NumAppliedRows; ++Index)
+			{
+				if (const FAbilityEditorImportRowChange* RowChange = Diff->RowChanges.Find(Diff->UpdatedRowNames[Index]))
+				{
+					Report.Rows.Add(*RowChange);
+				}
+			}
+
+			if (Report.Save(Info.DataTable))
+			{
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 字段变化报告：%s"), *FAbilityEditorImportReport::GetReportFilePath(Info.DataTable));
+			}
+		}
+
+		/** 按数据来源打开行读取器（只校验文件，内容在数据阶段读取） */
+		bool OpenRowSource()
+		{
+			if (Source == EIncrementalImportSource::Spreadsheet)
+			{
+				if (Info.Settings->ExcelPath.IsEmpty())
+				{
+					UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] UAbilityEditorHelperSettings 的 ExcelPath 未配置"));
+					return false;
+				}
+
+				// 与 Excel 文件名设置一致：可不带 .xlsx 后缀
+				FString ExcelFilePath = FPaths::Combine(Info.Settings->ExcelPath, SourceFileName);
+				if (FPaths::GetExtension(ExcelFilePath).IsEmpty() && !FPaths::DirectoryExists(ExcelFilePath))
+				{
+					ExcelFilePath += TEXT(".xlsx");
+				}
+
+				TUniquePtr<FAbilityEditorSpreadsheetRowReader> SpreadsheetReader = MakeUnique<FAbilityEditorSpreadsheetRowReader>();
+				if (!SpreadsheetReader->Open(ExcelFilePath, RowStruct))
+				{
+					UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] Excel 读取失败：%s"), *SpreadsheetReader->GetErrorMessage());
+					return false;
+				}
+				RowSource = MoveTemp(SpreadsheetReader);
+				return true;
+			}
+
+			// 构建 JSON 文件完整路径
+			if (Info.Settings->JsonPath.IsEmpty())
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] UAbilityEditorHelperSettings 的 JsonPath 未配置"));
+				return false;
+			}
+			const FString JsonFilePath = FPaths::Combine(Info.Settings->JsonPath, SourceFileName);
+
+			if (!FPaths::FileExists(JsonFilePath))
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] JSON 文件不存在：%s"), *JsonFilePath);
+				return false;
+			}
+
+			// .aebin 为 Python 工具导出的二进制行文件；JSON 直接在映射的 UTF-8 字节上流式解析
+			FString OpenError;
+			RowSource = OpenJsonRowSource(JsonFilePath, RowStruct, OpenError);
+			if (!RowSource)
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] %s"), *OpenError);
+				return false;
+			}
+			return true;
+		}
+
+		FGenerationTargetInfo Info;
+		EIncrementalImportSource Source = EIncrementalImportSource::Json;
+		FString SourceFileName;
+		bool bClearFolderFirst = false;
+
+		UScriptStruct* RowStruct = nullptr;
+		TUniquePtr<FAbilityEditorRowSource> RowSource;
+		FAbilityEditorImportManifest PreviousManifest;
+		FAbilityEditorImportManifest NewManifest;
+		/** 本次导入暂存行结构体的竞技场（新配置与可取消时保留的旧行），须先于 Diff 构造 */
+		TOptional<FAbilityEditorRowArena> RowArena;
+		TOptional<FJsonRowDiff> Diff;
+
+		/** 导入前的行内容（新增的行为空视图），仅可取消时保留，位于 RowArena 中 */
+		TMap<FName, FAbilityEditorRowView> PreviousRows;
+
+		/** 本次从 DataTable 删除的行（bDeleteRowsRemovedFromSource） */
+		TArray<FName> DeletedRowNames;
+
+		TOptional<FRowStampContext> StampContext;
+		int32 SuccessCount = 0;
+		int32 FailCount = 0;
+	};
+}
+
+bool UAbilityEditorHelperLibrary::ImportAndUpdateGameplayEffectsFromJson(
+	const FString& JsonFileName,
+	bool bClearGameplayEffectFolderFirst,
+	TArray<FName>& OutUpdatedRowNames)
+{
+	return ImportAndUpdateRowTypeFromJson(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect), JsonFileName, bClearGameplayEffectFolderFirst, OutUpdatedRowNames);
+}
+
+bool UAbilityEditorHelperLibrary::ImportAndUpdateGameplayEffectsFromExcel(
+	const FString& ExcelFileName,
+	bool bClearGameplayEffectFolderFirst,
+	TArray<FName>& OutUpdatedRowNames)
+{
+	return ImportAndUpdateRowTypeFromExcel(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect), ExcelFileName, bClearGameplayEffectFolderFirst, OutUpdatedRowNames);
 }
 
+// ===========================================
+// GameplayAbility 相关函数实现
+// ===========================================
+
 UGameplayAbility* UAbilityEditorHelperLibrary::CreateOrImportGameplayAbility(
 	const FString& GameplayAbilityPath,
 	const FGameplayAbilityConfig& Config,
@@ -1817,11 +2806,12 @@ UGameplayAbility* UAbilityEditorHelperLibrary::CreateOrImportGameplayAbility(
 	UClass* DesiredParentClass = UGameplayAbility::StaticClass();
 	if (!Config.ParentClass.IsEmpty())
 	{
-		if (UClass* LoadedClass = LoadClassFromPath<UGameplayAbility>(Config.ParentClass))
+		bool bReportFailure = false;
+		if (UClass* LoadedClass = ResolveClassFromPath<UGameplayAbility>(Config.ParentClass, &bReportFailure))
 		{
 			DesiredParentClass = LoadedClass;
 		}
-		else
+		else if (bReportFailure)
 		{
 			UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 无法加载 ParentClass：%s，使用默认类"), *Config.ParentClass);
 		}
@@ -1883,8 +2873,7 @@ UGameplayAbility* UAbilityEditorHelperLibrary::CreateOrImportGameplayAbility(
 			return nullptr;
 		}
 
-		FAssetRegistryModule::AssetCreated(ExistingBlueprint);
-		Package->MarkPackageDirty();
+		FAbilityEditorBulkImportScope::AssetCreated(ExistingBlueprint);
 		bIsNewlyCreated = true;
 	}
 
@@ -1905,411 +2894,821 @@ UGameplayAbility* UAbilityEditorHelperLibrary::CreateOrImportGameplayAbility(
 
 	// 写入配置数据到 GA（通过 UE 反射访问 protected 成员）
 	{
-		UClass* GAClass = UGameplayAbility::StaticClass();
+		// 属性句柄在模块启动时解析一次；解析失败的已在启动时报告，此处跳过
+		const FAbilityEditorPropertyHandles& Handles = FAbilityEditorPropertyHandles::Get();
 
 		// === 辅助 Lambda：通过反射设置 TSubclassOf<UGameplayEffect> 属性 ===
-		auto SetClassProperty = [&](const TCHAR* PropertyName, UClass* ClassValue)
+		auto SetClassProperty = [GA](FClassProperty* Prop, UClass* ClassValue)
 		{
-			if (!ClassValue) return;
-			if (FClassProperty* Prop = CastField<FClassProperty>(GAClass->FindPropertyByName(PropertyName)))
+			if (!Prop || !ClassValue) return;
+			void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(GA);
+			Prop->SetObjectPropertyValue(ValuePtr, ClassValue);
+		};
+
+		// === 辅助 Lambda：通过反射设置 FGameplayTagContainer 属性 ===
+		auto SetTagContainerProperty = [GA](FStructProperty* Prop, const FGameplayTagContainer& Tags)
+		{
+			if (!Prop) return;
+			FGameplayTagContainer* ValuePtr = Prop->ContainerPtrToValuePtr<FGameplayTagContainer>(GA);
+			if (ValuePtr)
 			{
-				void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(GA);
-				Prop->SetObjectPropertyValue(ValuePtr, ClassValue);
+				*ValuePtr = Tags;
 			}
 		};
 
-		// === 辅助 Lambda：通过反射设置 FGameplayTagContainer 属性 ===
-		auto SetTagContainerProperty = [&](const TCHAR* PropertyName, const FGameplayTagContainer& Tags)
+		// === 辅助 Lambda：通过反射设置 bool 属性 ===
+		auto SetBoolProperty = [GA](FBoolProperty* Prop, bool Value)
+		{
+			if (!Prop) return;
+			void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(GA);
+			Prop->SetPropertyValue(ValuePtr, Value);
+		};
+
+		// === 辅助 Lambda：通过反射设置 TEnumAsByte 属性 ===
+		auto SetByteProperty = [GA](FByteProperty* Prop, uint8 Value)
+		{
+			if (!Prop) return;
+			void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(GA);
+			Prop->SetPropertyValue(ValuePtr, Value);
+		};
+
+		// Cost GE
+		if (!Config.CostGameplayEffectClass.IsEmpty())
+		{
+			bool bReportFailure = false;
+			if (UClass* CostClass = ResolveClassFromPath<UGameplayEffect>(Config.CostGameplayEffectClass, &bReportFailure))
+			{
+				SetClassProperty(Handles.CostGameplayEffectClass, CostClass);
+			}
+			else if (bReportFailure)
+			{
+				UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 无法加载 CostGameplayEffectClass：%s"), *Config.CostGameplayEffectClass);
+			}
+		}
+
+		// Cooldown GE
+		if (!Config.CooldownGameplayEffectClass.IsEmpty())
 		{
-			if (FStructProperty* Prop = CastField<FStructProperty>(GAClass->FindPropertyByName(PropertyName)))
+			bool bReportFailure = false;
+			if (UClass* CooldownClass = ResolveClassFromPath<UGameplayEffect>(Config.CooldownGameplayEffectClass, &bReportFailure))
 			{
-				FGameplayTagContainer* ValuePtr = Prop->ContainerPtrToValuePtr<FGameplayTagContainer>(GA);
-				if (ValuePtr)
+				SetClassProperty(Handles.CooldownGameplayEffectClass, CooldownClass);
+			}
+			else if (bReportFailure)
+			{
+				UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 无法加载 CooldownGameplayEffectClass：%s"), *Config.CooldownGameplayEffectClass);
+			}
+		}
+
+		// Tags（UE 5.7 中这些是 FGameplayTagContainer 类型）
+		SetTagContainerProperty(Handles.AbilityTags, Config.AbilityTags);
+		SetTagContainerProperty(Handles.CancelAbilitiesWithTag, Config.CancelAbilitiesWithTag);
+		SetTagContainerProperty(Handles.BlockAbilitiesWithTag, Config.BlockAbilitiesWithTag);
+		SetTagContainerProperty(Handles.ActivationOwnedTags, Config.ActivationOwnedTags);
+		SetTagContainerProperty(Handles.ActivationRequiredTags, Config.ActivationRequiredTags);
+		SetTagContainerProperty(Handles.ActivationBlockedTags, Config.ActivationBlockedTags);
+		SetTagContainerProperty(Handles.SourceRequiredTags, Config.SourceRequiredTags);
+		SetTagContainerProperty(Handles.SourceBlockedTags, Config.SourceBlockedTags);
+		SetTagContainerProperty(Handles.TargetRequiredTags, Config.TargetRequiredTags);
+		SetTagContainerProperty(Handles.TargetBlockedTags, Config.TargetBlockedTags);
+
+		// Triggers（通过反射访问 TArray<FAbilityTriggerData>）
+		if (FArrayProperty* TriggersProp = Handles.AbilityTriggers)
+		{
+			TArray<FAbilityTriggerData>* TriggersPtr = TriggersProp->ContainerPtrToValuePtr<TArray<FAbilityTriggerData>>(GA);
+			if (TriggersPtr)
+			{
+				TriggersPtr->Empty();
+				for (const FAbilityTriggerConfig& TriggerConfig : Config.AbilityTriggers)
 				{
-					*ValuePtr = Tags;
+					FAbilityTriggerData TriggerData;
+					TriggerData.TriggerTag = TriggerConfig.TriggerTag;
+					TriggerData.TriggerSource = TriggerConfig.TriggerSource;
+					TriggersPtr->Add(TriggerData);
 				}
 			}
-		};
+		}
 
-		// === 辅助 Lambda：通过反射设置 bool 属性 ===
-		auto SetBoolProperty = [&](const TCHAR* PropertyName, bool Value)
+		// Advanced bool 属性
+		SetBoolProperty(Handles.bServerRespectsRemoteAbilityCancellation, Config.bServerRespectsRemoteAbilityCancellation);
+		SetBoolProperty(Handles.bReplicateInputDirectly, Config.bReplicateInputDirectly);
+		SetBoolProperty(Handles.bRetriggerInstancedAbility, Config.bRetriggerInstancedAbility);
+
+		// 枚举策略属性（TEnumAsByte）
+		SetByteProperty(Handles.NetExecutionPolicy, static_cast<uint8>(Config.NetExecutionPolicy));
+		SetByteProperty(Handles.NetSecurityPolicy, static_cast<uint8>(Config.NetSecurityPolicy));
+		SetByteProperty(Handles.InstancingPolicy, static_cast<uint8>(Config.InstancingPolicy));
+		SetByteProperty(Handles.ReplicationPolicy, static_cast<uint8>(Config.ReplicationPolicy));
+
+		// 广播后处理委托
+		if (GEditor)
 		{
-			if (FBoolProperty* Prop = CastField<FBoolProperty>(GAClass->FindPropertyByName(PropertyName)))
+			if (UAbilityEditorHelperSubsystem* Subsystem = GEditor->GetEditorSubsystem<UAbilityEditorHelperSubsystem>())
 			{
-				void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(GA);
-				Prop->SetPropertyValue(ValuePtr, Value);
+				Subsystem->BroadcastPostProcessGameplayAbility(&Config, GA);
 			}
-		};
+		}
 
-		// === 辅助 Lambda：通过反射设置 TEnumAsByte 属性 ===
-		auto SetByteProperty = [&](const TCHAR* PropertyName, uint8 Value)
+		// 变更检测：仅在属性实际发生变化时才标记脏包
+		if (bIsNewlyCreated)
+		{
+			FAbilityEditorBulkImportScope::MarkPackageDirty(ExistingBlueprint);
+		}
+		else
+		{
+			TArray<uint8> AfterBytes = SerializeObjectState(GA);
+			if (BeforeBytes != AfterBytes)
+			{
+				FAbilityEditorBulkImportScope::MarkPackageDirty(ExistingBlueprint);
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] GA 已变更，标记脏包：%s"), *GA->GetName());
+			}
+			else
+			{
+				UE_LOG(LogAbilityEditor, Verbose, TEXT("[AbilityEditorHelper] GA 未变更，跳过标记脏包：%s"), *GA->GetName());
+			}
+		}
+	}
+
+	bOutSuccess = GA != nullptr;
+	return GA;
+#else
+	bOutSuccess = (GA != nullptr);
+	return GA;
+#endif
+}
+
+bool UAbilityEditorHelperLibrary::CreateOrUpdateGameplayAbilitiesFromSettings(bool bClearGameplayAbilityFolderFirst, bool bForceFullUpdate)
+{
+	return CreateOrUpdateRowTypeAssets(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility), bClearGameplayAbilityFolderFirst, bForceFullUpdate);
+}
+
+bool UAbilityEditorHelperLibrary::IsBatchGenerationUpToDate(EAbilityEditorGenerationTarget Target, bool bClearFolderFirst)
+{
+	const FGenerationTargetInfo Info = MakeGenerationTargetInfo(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(Target));
+	if (!Info.bValid)
+	{
+		return false;
+	}
+
+	FAbilityEditorImportManifest Manifest;
+	return IsGenerationUpToDate(Info.DataTable, MakeGenerationFingerprint(Info.Settings, Info.DataTable, Info.BasePath, bClearFolderFirst), Manifest);
+}
+
+bool UAbilityEditorHelperLibrary::SaveBatchGenerationFingerprint(EAbilityEditorGenerationTarget Target, bool bClearFolderFirst)
+{
+	const FGenerationTargetInfo Info = MakeGenerationTargetInfo(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(Target));
+	if (!Info.bValid)
+	{
+		return false;
+	}
+	const FString& BasePath = Info.BasePath;
+
+#if WITH_EDITOR
+	// 资产由其他进程创建并保存，本进程的资产注册表需要重新扫描输出目录
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	AssetRegistryModule.Get().ScanPathsSynchronous({ BasePath }, true);
+#endif
+
+	// 加载已有清单以保留行记录（不存在时只初始化清单头）
+	FAbilityEditorImportManifest Manifest;
+	IsGenerationUpToDate(Info.DataTable, FString(), Manifest);
+	Manifest.GenerationFingerprint = MakeGenerationFingerprint(Info.Settings, Info.DataTable, BasePath, bClearFolderFirst);
+	return Manifest.Save(Info.DataTable);
+}
+
+bool UAbilityEditorHelperLibrary::GetGameplayEffectGenerationReport(FAbilityEditorGenerationReport& OutReport)
+{
+	return GetGenerationReport(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect), OutReport);
+}
+
+bool UAbilityEditorHelperLibrary::GetGameplayAbilityGenerationReport(FAbilityEditorGenerationReport& OutReport)
+{
+	return GetGenerationReport(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility), OutReport);
+}
+
+bool UAbilityEditorHelperLibrary::GetGenerationReport(FName RowType, FAbilityEditorGenerationReport& OutReport)
+{
+	OutReport = FAbilityEditorGenerationReport();
+
+	const FGenerationTargetInfo Info = MakeGenerationTargetInfo(RowType);
+	if (!Info.bValid)
+	{
+		UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] Settings 未找到或 DataTable 未设置。"));
+		return false;
+	}
+
+#if WITH_EDITOR
+	const UAbilityEditorHelperSettings* Settings = Info.Settings;
+	const UDataTable* DataTable = Info.DataTable;
+	const FString& BasePath = Info.BasePath;
+	const TCHAR* Prefix = Info.GetPrefix();
+
+	// 每行期望的资产名与当前配置印记
+	FRowStampContext StampContext(Settings, DataTable, false);
+	TMap<FName, FName> RowByAssetName;
+	TMap<FName, FString> StampByRow;
+	for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
+	{
+		if (RowPair.Value)
+		{
+			RowByAssetName.Add(MakeRowAssetName(RowPair.Key, Prefix), RowPair.Key);
+			StampByRow.Add(RowPair.Key, FAbilityEditorAssetStamp::Make(StampContext.ContextHash, StampContext.RowStruct, RowPair.Value));
+		}
+	}
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
+	Filter.PackagePaths.Add(FName(*BasePath));
+	Filter.ClassPaths.Add(Info.Type->AssetClassPath);
+
+	TArray<FAssetData> Assets;
+	AssetRegistryModule.Get().GetAssets(Filter, Assets);
+
+	// 与 FindOrphanedGeneratedAssets 相同的归属规则；无来源标签的资产按命名规则匹配行
+	const FString DataTablePath = DataTable->GetPathName();
+	TSet<FName> RowsWithAsset;
+	FString SourceTable;
+	FName SourceRow;
+	FString Stamp;
+	for (const FAssetData& AssetData : Assets)
+	{
+		const FName* MatchedRow = RowByAssetName.Find(AssetData.AssetName);
+		const FString AssetPath = AssetData.GetObjectPathString();
+
+		if (FAbilityEditorAssetStamp::ReadFromAssetData(AssetData, SourceTable, SourceRow, Stamp))
+		{
+			if (SourceTable != DataTablePath)
+			{
+				continue;
+			}
+			if (!MatchedRow || *MatchedRow != SourceRow)
+			{
+				OutReport.OrphanedAssets.Add(AssetPath);
+				continue;
+			}
+		}
+		else if (!MatchedRow)
+		{
+			OutReport.OrphanedAssets.Add(AssetPath);
+			continue;
+		}
+
+		RowsWithAsset.Add(*MatchedRow);
+		if (!Stamp.IsEmpty() && StampByRow.FindChecked(*MatchedRow) == Stamp)
+		{
+			OutReport.UpToDateAssets.Add(AssetPath);
+		}
+		else
+		{
+			OutReport.StaleAssets.Add(AssetPath);
+		}
+	}
+
+	for (const TPair<FName, FString>& RowStamp : StampByRow)
+	{
+		if (!RowsWithAsset.Contains(RowStamp.Key))
+		{
+			OutReport.MissingRows.Add(RowStamp.Key);
+		}
+	}
+
+	UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] %s 生成状态：最新 %d，待更新 %d，待创建 %d，孤儿 %d"),
+		Info.GetTypeName(),
+		OutReport.UpToDateAssets.Num(), OutReport.StaleAssets.Num(), OutReport.MissingRows.Num(), OutReport.OrphanedAssets.Num());
+	return true;
+#else
+	return false;
+#endif
+}
+
+// ===================== GE + GA 统一导入 =====================
+
+namespace
+{
+	/** 统一导入图中的节点（某个行类型 DataTable 的一行） */
+	struct FImportGraphNode
+	{
+		/** 所属行类型（由任务的生成目标上下文持有） */
+		const FAbilityEditorRowAssetType* Type = nullptr;
+		FName RowName;
+		FString AssetPath;
+		const uint8* RowData = nullptr;
+		const UDataTable* SourceTable = nullptr;
+
+		/** 行的配置印记；bStampUpToDate 为 true 时资产印记与之一致，本次跳过 */
+		FString Stamp;
+		bool bStampUpToDate = false;
+
+		/** 引用本节点的节点 */
+		TArray<int32> Dependents;
+
+		/** 尚未排序的被引用节点数量 */
+		int32 PendingDependencyCount = 0;
+	};
+
+	/** 收集节点配置中引用的资产路径（由行类型的 GatherReferences 提供，未提供时没有依赖） */
+	static void GatherReferencePaths(const FImportGraphNode& Node, TArray<FString>& OutPaths)
+	{
+		if (Node.Type->GatherReferences)
+		{
+			Node.Type->GatherReferences(Node.RowData, OutPaths);
+		}
+	}
+
+	/** 按包名建立引用边：被引用节点 -> 引用节点 */
+	static void BuildImportGraphEdges(TArray<FImportGraphNode>& Nodes)
+	{
+		TMap<FName, int32> NodeByPackage;
+		NodeByPackage.Reserve(Nodes.Num());
+		for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+		{
+			FString PackageName, AssetName, ObjectPath;
+			if (ParseAssetPath(Nodes[Index].AssetPath, PackageName, AssetName, ObjectPath))
+			{
+				NodeByPackage.Add(FName(*PackageName), Index);
+			}
+		}
+
+		TArray<FString> ReferencePaths;
+		for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+		{
+			ReferencePaths.Reset();
+			GatherReferencePaths(Nodes[Index], ReferencePaths);
+
+			for (const FString& ReferencePath : ReferencePaths)
+			{
+				FString PackageName, AssetName, ObjectPath;
+				if (!ParseAssetPath(ReferencePath, PackageName, AssetName, ObjectPath))
+				{
+					continue;
+				}
+
+				const int32* DependencyIndex = NodeByPackage.Find(FName(*PackageName));
+				if (!DependencyIndex || *DependencyIndex == Index || Nodes[*DependencyIndex].Dependents.Contains(Index))
+				{
+					continue;
+				}
+
+				Nodes[*DependencyIndex].Dependents.Add(Index);
+				++Nodes[Index].PendingDependencyCount;
+			}
+		}
+	}
+
+	/**
+	 * Kahn 拓扑排序：被引用的资产排在引用者之前，无依赖关系的节点保持 DataTable 中的原有顺序
+	 * @param OutCyclicNodes  处于循环引用（或依赖循环）中的节点，按原有顺序返回，不包含在排序结果中
+	 */
+	static TArray<int32> SortImportGraph(TArray<FImportGraphNode>& Nodes, TArray<int32>& OutCyclicNodes)
+	{
+		TArray<int32> Order;
+		Order.Reserve(Nodes.Num());
+		for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+		{
+			if (Nodes[Index].PendingDependencyCount == 0)
+			{
+				Order.Add(Index);
+			}
+		}
+
+		for (int32 Cursor = 0; Cursor < Order.Num(); ++Cursor)
 		{
-			if (FByteProperty* Prop = CastField<FByteProperty>(GAClass->FindPropertyByName(PropertyName)))
+			for (const int32 DependentIndex : Nodes[Order[Cursor]].Dependents)
 			{
-				void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(GA);
-				Prop->SetPropertyValue(ValuePtr, Value);
+				if (--Nodes[DependentIndex].PendingDependencyCount == 0)
+				{
+					Order.Add(DependentIndex);
+				}
+			}
+		}
+
+		OutCyclicNodes.Reset();
+		for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+		{
+			if (Nodes[Index].PendingDependencyCount > 0)
+			{
+				OutCyclicNodes.Add(Index);
+			}
+		}
+		return Order;
+	}
+
+	/**
+	 * 多个行类型（GE 与 GA）的统一生成：按拓扑顺序每个节点一个步骤，循环引用中的节点在最后各执行两遍
+	 * 被引用资产生成后的类记录在任务自身的注册表中，每个步骤执行期间生效
+	 */
+	class FUnifiedGenerationJob : public FAbilityEditorImportJob
+	{
+	public:
+		FUnifiedGenerationJob(const TArray<FGenerationTargetInfo>& InInfos, bool bInClearFoldersFirst, bool bInForceFullUpdate)
+			: bClearFoldersFirst(bInClearFoldersFirst)
+			, bForceFullUpdate(bInForceFullUpdate)
+		{
+			for (const FGenerationTargetInfo& Info : InInfos)
+			{
+				Targets.AddDefaulted_GetRef().Info = Info;
+			}
+		}
+
+		virtual FText GetDisplayName() const override
+		{
+			TArray<FString> TypeNames;
+			for (const FTargetState& State : Targets)
+			{
+				TypeNames.Add(State.Info.TypeName);
+			}
+			return FText::Format(NSLOCTEXT("AbilityEditorHelper", "UnifiedGenerationJob", "统一生成 {0}"), FText::FromString(FString::Join(TypeNames, TEXT(" / "))));
+		}
+
+		virtual bool Prepare(bool& bOutSuccess) override
+		{
+			bOutSuccess = false;
+			bool bAnyValid = false;
+			bool bAllUpToDate = true;
+			for (FTargetState& State : Targets)
+			{
+				const FGenerationTargetInfo& Info = State.Info;
+				if (!Info.bValid)
+				{
+					UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] %s 的 DataTable 未设置，统一导入将跳过该类型。"), Info.GetTypeName());
+					continue;
+				}
+				if (!Info.HasExpectedRowStruct())
+				{
+					UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] DataTable %s 的行结构不是 %s 或其派生类，统一导入将跳过该表。"),
+						*Info.DataTable->GetName(), *Info.GetExpectedRowStruct()->GetName());
+					continue;
+				}
+
+				State.bValid = true;
+				bAnyValid = true;
+				const FString Fingerprint = MakeGenerationFingerprint(Info.Settings, Info.DataTable, Info.BasePath, bClearFoldersFirst);
+				bAllUpToDate &= IsGenerationUpToDate(Info.DataTable, Fingerprint, State.Manifest);
 			}
-		};
 
-		// Cost GE
-		if (!Config.CostGameplayEffectClass.IsEmpty())
-		{
-			if (UClass* CostClass = LoadClassFromPath<UGameplayEffect>(Config.CostGameplayEffectClass))
+			if (!bAnyValid)
 			{
-				SetClassProperty(TEXT("CostGameplayEffectClass"), CostClass);
+				UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] Settings 未找到或各行类型的 DataTable 均未设置。"));
+				return false;
 			}
-		}
 
-		// Cooldown GE
-		if (!Config.CooldownGameplayEffectClass.IsEmpty())
-		{
-			if (UClass* CooldownClass = LoadClassFromPath<UGameplayEffect>(Config.CooldownGameplayEffectClass))
+			// 输入与上次成功的批量生成完全一致时直接返回
+			if (bAllUpToDate && !bForceFullUpdate)
 			{
-				SetClassProperty(TEXT("CooldownGameplayEffectClass"), CooldownClass);
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 输入指纹未变化，%s 无需更新（可使用 bForceFullUpdate 强制更新）。"), *GetDisplayName().ToString());
+				bOutSuccess = true;
+				return false;
 			}
+			return true;
 		}
 
-		// Tags（UE 5.7 中这些是 FGameplayTagContainer 类型）
-		SetTagContainerProperty(TEXT("AbilityTags"), Config.AbilityTags);
-		SetTagContainerProperty(TEXT("CancelAbilitiesWithTag"), Config.CancelAbilitiesWithTag);
-		SetTagContainerProperty(TEXT("BlockAbilitiesWithTag"), Config.BlockAbilitiesWithTag);
-		SetTagContainerProperty(TEXT("ActivationOwnedTags"), Config.ActivationOwnedTags);
-		SetTagContainerProperty(TEXT("ActivationRequiredTags"), Config.ActivationRequiredTags);
-		SetTagContainerProperty(TEXT("ActivationBlockedTags"), Config.ActivationBlockedTags);
-		SetTagContainerProperty(TEXT("SourceRequiredTags"), Config.SourceRequiredTags);
-		SetTagContainerProperty(TEXT("SourceBlockedTags"), Config.SourceBlockedTags);
-		SetTagContainerProperty(TEXT("TargetRequiredTags"), Config.TargetRequiredTags);
-		SetTagContainerProperty(TEXT("TargetBlockedTags"), Config.TargetBlockedTags);
-
-		// Triggers（通过反射访问 TArray<FAbilityTriggerData>）
-		if (FArrayProperty* TriggersProp = CastField<FArrayProperty>(GAClass->FindPropertyByName(TEXT("AbilityTriggers"))))
+		virtual bool BeginAssetStage() override
 		{
-			TArray<FAbilityTriggerData>* TriggersPtr = TriggersProp->ContainerPtrToValuePtr<TArray<FAbilityTriggerData>>(GA);
-			if (TriggersPtr)
+#if WITH_EDITOR
+			if (bClearFoldersFirst)
 			{
-				TriggersPtr->Empty();
-				for (const FAbilityTriggerConfig& TriggerConfig : Config.AbilityTriggers)
+				for (const FTargetState& State : Targets)
 				{
-					FAbilityTriggerData TriggerData;
-					TriggerData.TriggerTag = TriggerConfig.TriggerTag;
-					TriggerData.TriggerSource = TriggerConfig.TriggerSource;
-					TriggersPtr->Add(TriggerData);
+					if (State.bValid)
+					{
+						State.Info.CleanupFolder();
+					}
 				}
 			}
-		}
+#endif
 
-		// Advanced bool 属性
-		SetBoolProperty(TEXT("bServerRespectsRemoteAbilityCancellation"), Config.bServerRespectsRemoteAbilityCancellation);
-		SetBoolProperty(TEXT("bReplicateInputDirectly"), Config.bReplicateInputDirectly);
-		SetBoolProperty(TEXT("bRetriggerInstancedAbility"), Config.bRetriggerInstancedAbility);
+			// 各张表的所有行构成一个引用图
+			for (const FTargetState& State : Targets)
+			{
+				if (!State.bValid)
+				{
+					continue;
+				}
 
-		// 枚举策略属性（TEnumAsByte）
-		SetByteProperty(TEXT("NetExecutionPolicy"), static_cast<uint8>(Config.NetExecutionPolicy));
-		SetByteProperty(TEXT("NetSecurityPolicy"), static_cast<uint8>(Config.NetSecurityPolicy));
-		SetByteProperty(TEXT("InstancingPolicy"), static_cast<uint8>(Config.InstancingPolicy));
-		SetByteProperty(TEXT("ReplicationPolicy"), static_cast<uint8>(Config.ReplicationPolicy));
+				const FGenerationTargetInfo& Info = State.Info;
+				FRowStampContext StampContext(Info.Settings, Info.DataTable, bForceFullUpdate);
+				for (const TPair<FName, uint8*>& RowPair : Info.DataTable->GetRowMap())
+				{
+					if (!RowPair.Value)
+					{
+						continue;
+					}
 
-		// 广播后处理委托
-		if (GEditor)
-		{
-			if (UAbilityEditorHelperSubsystem* Subsystem = GEditor->GetEditorSubsystem<UAbilityEditorHelperSubsystem>())
+					FImportGraphNode& Node = Nodes.AddDefaulted_GetRef();
+					Node.Type = Info.Type.Get();
+					Node.RowName = RowPair.Key;
+					Node.AssetPath = MakeRowAssetPath(Info.BasePath, RowPair.Key, Info.GetPrefix());
+					Node.RowData = RowPair.Value;
+					Node.SourceTable = Info.DataTable;
+					Node.bStampUpToDate = StampContext.IsUpToDate(Node.AssetPath, Node.RowData, Node.Stamp);
+				}
+				StampContext.LogSkipped(Info.GetTypeName());
+			}
+
+			BuildImportGraphEdges(Nodes);
+			Order = SortImportGraph(Nodes, CyclicNodes);
+			if (CyclicNodes.Num() > 0)
 			{
-				Subsystem->BroadcastPostProcessGameplayAbility(&Config, GA);
+				FString CyclicNames;
+				for (const int32 Index : CyclicNodes)
+				{
+					CyclicNames += (CyclicNames.IsEmpty() ? TEXT("") : TEXT(", ")) + Nodes[Index].AssetPath;
+				}
+				UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 检测到 %d 个资产之间存在循环引用，将在其余资产之后生成两遍：%s"), CyclicNodes.Num(), *CyclicNames);
 			}
+			return true;
 		}
 
-		// 变更检测：仅在属性实际发生变化时才标记脏包
-		if (bIsNewlyCreated)
+		/** 拓扑顺序中的节点各一步；循环引用：第一遍使所有资产都已生成，第二遍解析第一遍中尚不存在的引用 */
+		virtual int32 GetNumAssetSteps() const override
 		{
-			ExistingBlueprint->MarkPackageDirty();
+			return Order.Num() + CyclicNodes.Num() * 2;
 		}
-		else
+
+		virtual void ExecuteAssetStep(int32 StepIndex) override
 		{
-			TArray<uint8> AfterBytes = SerializeObjectState(GA);
-			if (BeforeBytes != AfterBytes)
+			int32 Index = INDEX_NONE;
+			bool bCountResult = true;
+			if (StepIndex < Order.Num())
 			{
-				ExistingBlueprint->MarkPackageDirty();
-				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] GA 已变更，标记脏包：%s"), *GA->GetName());
+				Index = Order[StepIndex];
 			}
 			else
 			{
-				UE_LOG(LogAbilityEditor, Verbose, TEXT("[AbilityEditorHelper] GA 未变更，跳过标记脏包：%s"), *GA->GetName());
+				const int32 CyclicStep = StepIndex - Order.Num();
+				Index = CyclicNodes[CyclicStep % CyclicNodes.Num()];
+				bCountResult = CyclicStep >= CyclicNodes.Num();
 			}
-		}
-	}
-
-	bOutSuccess = GA != nullptr;
-	return GA;
-#else
-	bOutSuccess = (GA != nullptr);
-	return GA;
-#endif
-}
-
-void UAbilityEditorHelperLibrary::CreateOrUpdateGameplayAbilitiesFromSettings(bool bClearGameplayAbilityFolderFirst)
-{
-	const UAbilityEditorHelperSettings* Settings = nullptr;
-	UDataTable* DataTable = nullptr;
-	if (!GetGASettingsAndDataTable(Settings, DataTable))
-	{
-		UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] Settings 未找到或 DataTable 未设置。"));
-		return;
-	}
-
-	// 校验行结构
-	if (!DataTable->GetRowStruct() || !DataTable->GetRowStruct()->IsChildOf(FGameplayAbilityConfig::StaticStruct()))
-	{
-		UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] DataTable 行结构不是 FGameplayAbilityConfig 或其派生类，无法导入。"));
-		return;
-	}
 
-	FString BasePath = GetGameplayAbilityBasePath(Settings);
+			// 印记一致的节点不生成；引用它们的节点按路径加载已有资产
+			const FImportGraphNode& Node = Nodes[Index];
+			if (Node.bStampUpToDate)
+			{
+				return;
+			}
 
-#if WITH_EDITOR
-	if (bClearGameplayAbilityFolderFirst)
-	{
-		CleanupGameplayAbilityFolder(BasePath, DataTable);
-	}
-#endif
+			// 异步导入的两帧之间 DataTable 可能被编辑，按行名重新查找行数据
+			const uint8* RowData = Node.SourceTable->FindRowUnchecked(Node.RowName);
+			if (!RowData)
+			{
+				return;
+			}
 
-	// 遍历每一行并创建/更新 GA
-	int32 SuccessCount = 0;
-	int32 FailCount = 0;
+			// 生成期间被引用的资产直接从内存中取类
+			TGuardValue<FImportedClassRegistry*> RegistryGuard(GActiveImportedClassRegistry, &ImportedClasses);
 
-	for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
-	{
-		const FName RowName = RowPair.Key;
-		const uint8* RowData = RowPair.Value;
+			const int32 UnresolvedBefore = GUnresolvedReferenceCount;
+			UObject* Asset = Node.Type->ApplyRow(Node.AssetPath, RowData);
+			if (Asset)
+			{
+				FRowStampContext::Apply(Asset, Node.Stamp, Node.SourceTable, Node.RowName, UnresolvedBefore);
+				ImportedClasses.Register(Asset);
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 成功创建/更新：%s"), *Node.AssetPath);
+			}
+			else
+			{
+				UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 创建/更新失败：%s"), *Node.AssetPath);
+			}
 
-		if (!RowData)
-		{
-			continue;
+			if (bCountResult)
+			{
+				if (Asset)
+				{
+					++SuccessCount;
+				}
+				else
+				{
+					++FailCount;
+				}
+			}
 		}
 
-		const FGameplayAbilityConfig* Config = reinterpret_cast<const FGameplayAbilityConfig*>(RowData);
-
-		FString RowAssetName = RowName.ToString();
-		if (!RowAssetName.Contains(TEXT("GA_")))
+		virtual bool Finish(FAbilityEditorBulkImportScope& Scope, int32 NumStepsDone) override
 		{
-			RowAssetName = TEXT("GA_") + RowAssetName;
-		}
+			const bool bCancelled = NumStepsDone < GetNumAssetSteps();
+			if (bCancelled)
+			{
+				UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] %s 已取消：已处理 %d / %d 步，成功 %d 个，失败 %d 个"),
+					*GetDisplayName().ToString(), NumStepsDone, GetNumAssetSteps(), SuccessCount, FailCount);
+			}
+			else
+			{
+				UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] %s 完成：成功 %d 个，失败 %d 个"), *GetDisplayName().ToString(), SuccessCount, FailCount);
+			}
 
-		const FString GAPath = FString::Printf(TEXT("%s/%s"), *BasePath, *RowAssetName);
+			// 先刷新通知，使新建资产进入资产注册表；可选：保存本次新建或变化的包（保存失败视为未全部成功）
+			Scope.Flush();
+			bool bSaved = true;
+			if (GetDefault<UAbilityEditorHelperSettings>()->bSaveChangedPackagesAfterImport && Scope.IsRootScope())
+			{
+				bSaved = Scope.SaveTouchedPackages();
+			}
 
-		bool bOK = false;
-		UGameplayAbility* GA = CreateOrImportGameplayAbility(GAPath, *Config, bOK);
+			// 全部成功并已保存后分别记录各表的指纹（生成过程可能新建资产，需重新计算）
+			const bool bAllSucceeded = FailCount == 0 && !bCancelled && bSaved;
+			if (bAllSucceeded)
+			{
+				for (FTargetState& State : Targets)
+				{
+					if (State.bValid)
+					{
+						State.Manifest.GenerationFingerprint = MakeGenerationFingerprint(State.Info.Settings, State.Info.DataTable, State.Info.BasePath, bClearFoldersFirst);
+						State.Manifest.Save(State.Info.DataTable);
+					}
+				}
+			}
+			return bAllSucceeded;
+		}
 
-		if (bOK && GA)
+		virtual void AddReferencedObjects(FReferenceCollector& Collector) override
 		{
-			UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 成功创建/更新 GameplayAbility：%s"), *GAPath);
-			++SuccessCount;
+			for (FTargetState& State : Targets)
+			{
+				Collector.AddReferencedObject(State.Info.DataTable);
+			}
 		}
-		else
+
+		virtual FString GetReferencerName() const override
 		{
-			UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 创建/更新失败：%s"), *GAPath);
-			++FailCount;
+			return TEXT("FUnifiedGenerationJob");
 		}
-	}
-
-	UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] GA 导入完成：成功 %d 个，失败 %d 个"), SuccessCount, FailCount);
-}
-
-bool UAbilityEditorHelperLibrary::ImportAndUpdateGameplayAbilitiesFromJson(
-	const FString& JsonFileName,
-	bool bClearGameplayAbilityFolderFirst,
-	TArray<FName>& OutUpdatedRowNames)
-{
-	OutUpdatedRowNames.Reset();
 
-	const UAbilityEditorHelperSettings* Settings = nullptr;
-	UDataTable* DataTable = nullptr;
-	if (!GetGASettingsAndDataTable(Settings, DataTable))
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("无法获取 Settings 或 DataTable"));
-		return false;
-	}
+	private:
+		/** 每种目标资产的生成上下文 */
+		struct FTargetState
+		{
+			FGenerationTargetInfo Info;
+			FAbilityEditorImportManifest Manifest;
+			bool bValid = false;
+		};
 
-	// 校验行结构
-	UScriptStruct* RowStruct = const_cast<UScriptStruct*>(DataTable->GetRowStruct());
-	if (!RowStruct || !RowStruct->IsChildOf(FGameplayAbilityConfig::StaticStruct()))
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("DataTable 行结构不是 FGameplayAbilityConfig 或其派生类"));
-		return false;
-	}
+		TArray<FTargetState> Targets;
+		bool bClearFoldersFirst = false;
+		bool bForceFullUpdate = false;
 
-	const int32 StructSize = RowStruct->GetStructureSize();
+		TArray<FImportGraphNode> Nodes;
+		TArray<int32> Order;
+		TArray<int32> CyclicNodes;
+		FImportedClassRegistry ImportedClasses;
 
-	// 构建 JSON 文件完整路径
-	if (Settings->JsonPath.IsEmpty())
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("UAbilityEditorHelperSettings 的 JsonPath 未配置"));
-		return false;
-	}
-	const FString JsonFilePath = FPaths::Combine(Settings->JsonPath, JsonFileName);
+		int32 SuccessCount = 0;
+		int32 FailCount = 0;
+	};
+}
 
-	if (!FPaths::FileExists(JsonFilePath))
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("JSON 文件不存在：%s"), *JsonFilePath);
-		return false;
-	}
+bool UAbilityEditorHelperLibrary::CreateOrUpdateGameplayEffectsAndAbilitiesFromSettings(bool bClearFoldersFirst, bool bForceFullUpdate)
+{
+	const TArray<FName> RowTypes = {
+		FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect),
+		FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility)
+	};
+	return CreateOrUpdateRowTypesAssets(RowTypes, bClearFoldersFirst, bForceFullUpdate);
+}
 
-	// 读取 JSON 文件内容
-	FString JsonContent;
-	if (!FFileHelper::LoadFileToString(JsonContent, *JsonFilePath))
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("无法读取 JSON 文件：%s"), *JsonFilePath);
-		return false;
-	}
+// ===================== 导入任务工厂 =====================
 
-	// 解析 JSON 为数组
-	TArray<TSharedPtr<FJsonValue>> JsonArray;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonContent);
-	if (!FJsonSerializer::Deserialize(Reader, JsonArray))
-	{
-		UE_LOG(LogAbilityEditor, Error, TEXT("JSON 解析失败，格式不正确"));
-		return false;
-	}
+TSharedRef<FAbilityEditorImportJob> FAbilityEditorImportJob::MakeTableGenerationJob(FName RowType, bool bClearFolderFirst, bool bForceFullUpdate)
+{
+	return MakeShared<FTableGenerationJob>(MakeGenerationTargetInfo(RowType), bClearFolderFirst, bForceFullUpdate);
+}
 
-	// 缓存现有 DataTable 数据的 JSON 表示
-	TMap<FName, FString> ExistingJsonMap;
-	for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
+TSharedRef<FAbilityEditorImportJob> FAbilityEditorImportJob::MakeUnifiedGenerationJob(const TArray<FName>& RowTypes, bool bClearFoldersFirst, bool bForceFullUpdate)
+{
+	TArray<FGenerationTargetInfo> Infos;
+	for (const FName& RowType : RowTypes)
 	{
-		if (RowPair.Value)
-		{
-			FString JsonStr = SerializeStructToJsonString(RowStruct, RowPair.Value);
-			ExistingJsonMap.Add(RowPair.Key, JsonStr);
-		}
+		Infos.Add(MakeGenerationTargetInfo(RowType));
 	}
+	return MakeShared<FUnifiedGenerationJob>(Infos, bClearFoldersFirst, bForceFullUpdate);
+}
 
-	// 解析新配置
-	TMap<FName, TSharedPtr<uint8, ESPMode::ThreadSafe>> NewConfigsMemory;
-	TMap<FName, FString> NewJsonMap;
-
-	for (const TSharedPtr<FJsonValue>& JsonValue : JsonArray)
-	{
-		if (!JsonValue.IsValid() || JsonValue->Type != EJson::Object)
-		{
-			continue;
-		}
-
-		const TSharedPtr<FJsonObject>& JsonObject = JsonValue->AsObject();
-		if (!JsonObject.IsValid())
-		{
-			continue;
-		}
+TSharedRef<FAbilityEditorImportJob> FAbilityEditorImportJob::MakeJsonImportJob(FName RowType, const FString& JsonFileName, bool bClearFolderFirst)
+{
+	return MakeShared<FIncrementalImportJob>(MakeGenerationTargetInfo(RowType), EIncrementalImportSource::Json, JsonFileName, bClearFolderFirst);
+}
 
-		FString RowNameStr;
-		if (!JsonObject->TryGetStringField(TEXT("Name"), RowNameStr) || RowNameStr.IsEmpty())
-		{
-			UE_LOG(LogAbilityEditor, Warning, TEXT("JSON 条目缺少 Name 字段，已跳过"));
-			continue;
-		}
+TSharedRef<FAbilityEditorImportJob> FAbilityEditorImportJob::MakeExcelImportJob(FName RowType, const FString& ExcelFileName, bool bClearFolderFirst)
+{
+	return MakeShared<FIncrementalImportJob>(MakeGenerationTargetInfo(RowType), EIncrementalImportSource::Spreadsheet, ExcelFileName, bClearFolderFirst);
+}
 
-		TSharedPtr<uint8, ESPMode::ThreadSafe> ConfigMemory(
-			static_cast<uint8*>(FMemory::Malloc(StructSize)),
-			[](uint8* Ptr) { FMemory::Free(Ptr); }
-		);
-		RowStruct->InitializeStruct(ConfigMemory.Get());
+// ===================== 按行类型导入 =====================
 
-		if (!FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), RowStruct, ConfigMemory.Get()))
-		{
-			UE_LOG(LogAbilityEditor, Warning, TEXT("无法反序列化行 %s，已跳过"), *RowNameStr);
-			RowStruct->DestroyStruct(ConfigMemory.Get());
-			continue;
-		}
+bool UAbilityEditorHelperLibrary::CreateOrUpdateRowTypeAssets(FName RowType, bool bClearFolderFirst, bool bForceFullUpdate)
+{
+	return FAbilityEditorImportJob::MakeTableGenerationJob(RowType, bClearFolderFirst, bForceFullUpdate)->RunToCompletion();
+}
 
-		FName RowName(*RowNameStr);
-		NewConfigsMemory.Add(RowName, ConfigMemory);
+bool UAbilityEditorHelperLibrary::CreateOrUpdateRowTypesAssets(const TArray<FName>& RowTypes, bool bClearFoldersFirst, bool bForceFullUpdate)
+{
+	return FAbilityEditorImportJob::MakeUnifiedGenerationJob(RowTypes, bClearFoldersFirst, bForceFullUpdate)->RunToCompletion();
+}
 
-		FString NewJsonStr = SerializeStructToJsonString(RowStruct, ConfigMemory.Get());
-		NewJsonMap.Add(RowName, NewJsonStr);
+bool UAbilityEditorHelperLibrary::ImportAndUpdateRowTypeFromJson(FName RowType, const FString& JsonFileName, bool bClearFolderFirst, TArray<FName>& OutUpdatedRowNames)
+{
+	const TSharedRef<FAbilityEditorImportJob> Job = FAbilityEditorImportJob::MakeJsonImportJob(RowType, JsonFileName, bClearFolderFirst);
+	const bool bSuccess = Job->RunToCompletion();
+	OutUpdatedRowNames = Job->GetUpdatedRowNames();
+	return bSuccess;
+}
 
-		const FString* ExistingJson = ExistingJsonMap.Find(RowName);
-		if (!ExistingJson || !ExistingJson->Equals(NewJsonStr))
-		{
-			OutUpdatedRowNames.Add(RowName);
-			UE_LOG(LogAbilityEditor, Log, TEXT("检测到变化的行：%s"), *RowNameStr);
-		}
-	}
+bool UAbilityEditorHelperLibrary::ImportAndUpdateRowTypeFromExcel(FName RowType, const FString& ExcelFileName, bool bClearFolderFirst, TArray<FName>& OutUpdatedRowNames)
+{
+	const TSharedRef<FAbilityEditorImportJob> Job = FAbilityEditorImportJob::MakeExcelImportJob(RowType, ExcelFileName, bClearFolderFirst);
+	const bool bSuccess = Job->RunToCompletion();
+	OutUpdatedRowNames = Job->GetUpdatedRowNames();
+	return bSuccess;
+}
 
-	if (OutUpdatedRowNames.Num() == 0)
+TArray<FName> UAbilityEditorHelperLibrary::GetRegisteredRowTypes()
+{
+	TArray<FName> RowTypes;
+	for (const TSharedRef<const FAbilityEditorRowAssetType>& Type : FAbilityEditorRowAssetTypeRegistry::GetAll())
 	{
-		UE_LOG(LogAbilityEditor, Log, TEXT("未检测到任何数据变化，无需更新"));
-		return true;
+		RowTypes.Add(Type->Name);
 	}
+	return RowTypes;
+}
 
-	UE_LOG(LogAbilityEditor, Log, TEXT("共检测到 %d 行数据变化"), OutUpdatedRowNames.Num());
+// ===================== 内置行类型：GameplayEffect 与 GameplayAbility =====================
 
-#if WITH_EDITOR
-	// 更新 DataTable
-	for (const FName& RowName : OutUpdatedRowNames)
+void FAbilityEditorRowAssetTypeRegistry::RegisterBuiltInTypes()
+{
+	FAbilityEditorRowAssetType EffectType;
+	EffectType.Name = GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect);
+	EffectType.RowStruct = FGameplayEffectConfig::StaticStruct();
+	EffectType.AssetPrefix = TEXT("GE_");
+	EffectType.AssetClassPath = UGameplayEffect::StaticClass()->GetClassPathName();
+	EffectType.ResolveTable = [](UDataTable*& OutDataTable, FString& OutBasePath)
+	{
+		const UAbilityEditorHelperSettings* Settings = GetDefault<UAbilityEditorHelperSettings>();
+		OutDataTable = LoadSettingsDataTable(Settings->GameplayEffectDataTable, TEXT("GameplayEffectDataTable"));
+		OutBasePath = NormalizeAssetBasePath(Settings->GameplayEffectPath, TEXT("/Game/GameplayEffects"));
+		return OutDataTable != nullptr;
+	};
+	EffectType.ApplyRow = [](const FString& AssetPath, const uint8* RowData) -> UObject*
 	{
-		TSharedPtr<uint8, ESPMode::ThreadSafe>* NewConfigMemory = NewConfigsMemory.Find(RowName);
-		if (!NewConfigMemory || !NewConfigMemory->IsValid())
-		{
-			continue;
-		}
-
-		uint8* ExistingRowData = DataTable->FindRowUnchecked(RowName);
-		if (ExistingRowData)
-		{
-			RowStruct->CopyScriptStruct(ExistingRowData, NewConfigMemory->Get());
-		}
-		else
-		{
-			DataTable->AddRow(RowName, *reinterpret_cast<FTableRowBase*>(NewConfigMemory->Get()));
-		}
-	}
-
-	DataTable->MarkPackageDirty();
-
-	FString BasePath = GetGameplayAbilityBasePath(Settings);
-
-	if (bClearGameplayAbilityFolderFirst)
+		bool bOK = false;
+		UObject* Asset = UAbilityEditorHelperLibrary::CreateOrImportGameplayEffect(AssetPath, *reinterpret_cast<const FGameplayEffectConfig*>(RowData), bOK);
+		return bOK ? Asset : nullptr;
+	};
+	EffectType.GatherReferences = [](const uint8* RowData, TArray<FString>& OutPaths)
 	{
-		CleanupGameplayAbilityFolder(BasePath, DataTable);
-	}
-
-	// 创建/更新 GA
-	int32 SuccessCount = 0;
-	int32 FailCount = 0;
-
-	for (const FName& RowName : OutUpdatedRowNames)
+		const FGameplayEffectConfig* Config = reinterpret_cast<const FGameplayEffectConfig*>(RowData);
+		OutPaths.Add(Config->ParentClass);
+		OutPaths.Append(Config->GrantedAbilityClasses);
+	};
+	Register(EffectType);
+
+	FAbilityEditorRowAssetType AbilityType;
+	AbilityType.Name = GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility);
+	AbilityType.RowStruct = FGameplayAbilityConfig::StaticStruct();
+	AbilityType.AssetPrefix = TEXT("GA_");
+	AbilityType.AssetClassPath = UBlueprint::StaticClass()->GetClassPathName();
+	AbilityType.ResolveTable = [](UDataTable*& OutDataTable, FString& OutBasePath)
+	{
+		const UAbilityEditorHelperSettings* Settings = GetDefault<UAbilityEditorHelperSettings>();
+		OutDataTable = LoadSettingsDataTable(Settings->GameplayAbilityDataTable, TEXT("GameplayAbilityDataTable"));
+		OutBasePath = NormalizeAssetBasePath(Settings->GameplayAbilityPath, TEXT("/Game/Abilities/Abilities"));
+		return OutDataTable != nullptr;
+	};
+	AbilityType.ApplyRow = [](const FString& AssetPath, const uint8* RowData) -> UObject*
 	{
-		uint8* ConfigData = DataTable->FindRowUnchecked(RowName);
-		if (!ConfigData)
-		{
-			continue;
-		}
-		const FGameplayAbilityConfig* Config = reinterpret_cast<const FGameplayAbilityConfig*>(ConfigData);
-
-		FString RowAssetName = RowName.ToString();
-		if (!RowAssetName.Contains(TEXT("GA_")))
-		{
-			RowAssetName = TEXT("GA_") + RowAssetName;
-		}
-		const FString GAPath = FString::Printf(TEXT("%s/%s"), *BasePath, *RowAssetName);
-
 		bool bOK = false;
-		UGameplayAbility* GA = CreateOrImportGameplayAbility(GAPath, *Config, bOK);
-		if (bOK && GA)
-		{
-			UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 成功创建/更新 GameplayAbility：%s"), *GAPath);
-			++SuccessCount;
-		}
-		else
-		{
-			UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 创建/更新失败：%s"), *GAPath);
-			++FailCount;
-		}
-	}
+		UObject* Asset = UAbilityEditorHelperLibrary::CreateOrImportGameplayAbility(AssetPath, *reinterpret_cast<const FGameplayAbilityConfig*>(RowData), bOK);
+		return bOK ? Asset : nullptr;
+	};
+	AbilityType.GatherReferences = [](const uint8* RowData, TArray<FString>& OutPaths)
+	{
+		const FGameplayAbilityConfig* Config = reinterpret_cast<const FGameplayAbilityConfig*>(RowData);
+		OutPaths.Add(Config->ParentClass);
+		OutPaths.Add(Config->CostGameplayEffectClass);
+		OutPaths.Add(Config->CooldownGameplayEffectClass);
+	};
+	Register(AbilityType);
+}
 
-	UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] GA 增量更新完成：成功 %d 个，失败 %d 个"), SuccessCount, FailCount);
+void FAbilityEditorRowAssetTypeRegistry::UnregisterBuiltInTypes()
+{
+	Unregister(GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayEffect));
+	Unregister(GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility));
+}
 
-	return FailCount == 0;
-#else
-	return false;
-#endif
+bool UAbilityEditorHelperLibrary::ImportAndUpdateGameplayAbilitiesFromJson(
+	const FString& JsonFileName,
+	bool bClearGameplayAbilityFolderFirst,
+	TArray<FName>& OutUpdatedRowNames)
+{
+	return ImportAndUpdateRowTypeFromJson(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility), JsonFileName, bClearGameplayAbilityFolderFirst, OutUpdatedRowNames);
+}
+
+bool UAbilityEditorHelperLibrary::ImportAndUpdateGameplayAbilitiesFromExcel(
+	const FString& ExcelFileName,
+	bool bClearGameplayAbilityFolderFirst,
+	TArray<FName>& OutUpdatedRowNames)
+{
+	return ImportAndUpdateRowTypeFromExcel(FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget::GameplayAbility), ExcelFileName, bClearGameplayAbilityFolderFirst, OutUpdatedRowNames);
 }
 
 // ===========================================
@@ -5,6 +5,7 @@
 #include "GameplayEffect.h"
 #include "Abilities/GameplayAbility.h"
 #include "AbilityEditorTypes.h"
+#include "AbilityEditorStructHash.h"
 
 UAbilityEditorHelperSettings::UAbilityEditorHelperSettings()
 {
@@ -47,3 +48,18 @@ UAbilityEditorHelperSettings::UAbilityEditorHelperSettings()
 	}
 }
 
+uint64 UAbilityEditorHelperSettings::GetGenerationSettingsHash() const
+{
+	static const FName GenerationPropertyNames[] =
+	{
+		GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, GameplayEffectClass),
+		GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, GameplayEffectDataTable),
+		GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, GameplayEffectPath),
+		GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, GameplayEffectDataType),
+		GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, GameplayAbilityClass),
+		GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, GameplayAbilityDataTable),
+		GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, GameplayAbilityPath),
+		GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, GameplayAbilityDataType),
+	};
+	return FAbilityEditorStructHash::HashObjectProperties(this, GenerationPropertyNames);
+}
@@ -4,6 +4,38 @@
 #include "GameplayEffect.h"
 #include "Abilities/GameplayAbility.h"
 
+#if WITH_EDITOR
+#include "AbilityEditorAsyncImport.h"
+#include "AbilityEditorHelperLibrary.h"
+#include "AbilityEditorSpreadsheetReader.h"
+#include "AbilityEditorBinaryRowReader.h"
+#include "AbilityEditorTypes.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "Misc/Paths.h"
+#endif
+
+#if WITH_EDITOR
+namespace
+{
+	/** 表对应的源文件基础名（Settings 中的 Excel 文件名可带或不带后缀，JSON 与其同名） */
+	FString GetSourceBaseName(const UAbilityEditorHelperSettings* Settings, EAbilityEditorGenerationTarget Target)
+	{
+		const FString& ExcelName = Target == EAbilityEditorGenerationTarget::GameplayEffect
+			? Settings->GameplayEffectExcelName
+			: Settings->GameplayAbilityExcelName;
+		return FPaths::GetBaseFilename(ExcelName);
+	}
+
+	FString ToWatchDirectory(const FString& Path)
+	{
+		FString Directory = FPaths::ConvertRelativePathToFull(Path);
+		FPaths::NormalizeDirectoryName(Directory);
+		return Directory;
+	}
+}
+#endif
+
 void UAbilityEditorHelperSubsystem::BroadcastPostProcessGameplayEffect(const FTableRowBase* Config, UGameplayEffect* GE)
 {
 	if (OnPostProcessGameplayEffect.IsBound())
@@ -60,4 +92,238 @@ void UAbilityEditorHelperSubsystem::Initialize(FSubsystemCollectionBase& Collect
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 未能加载 GameplayAbilityDataTable，请检查设置。"));
 	}
+
+#if WITH_EDITOR
+	// 监视模式：Settings 中修改相关配置后重新注册目录监视
+	SettingsChangedHandle = GetMutableDefault<UAbilityEditorHelperSettings>()->OnSettingChanged().AddUObject(
+		this, &UAbilityEditorHelperSubsystem::OnSettingsChanged);
+	RefreshSourceFileWatchers();
+#endif
+}
+
+void UAbilityEditorHelperSubsystem::Deinitialize()
+{
+#if WITH_EDITOR
+	if (UAbilityEditorHelperSettings* Settings = GetMutableDefault<UAbilityEditorHelperSettings>())
+	{
+		Settings->OnSettingChanged().Remove(SettingsChangedHandle);
+	}
+	SettingsChangedHandle.Reset();
+	StopWatchingSourceFiles();
+#endif
+
+	CachedGameplayEffectDataTable = nullptr;
+	CachedGameplayAbilityDataTable = nullptr;
+	Super::Deinitialize();
+}
+
+void UAbilityEditorHelperSubsystem::RefreshSourceFileWatchers()
+{
+#if WITH_EDITOR
+	StopWatchingSourceFiles();
+
+	const UAbilityEditorHelperSettings* Settings = GetDefault<UAbilityEditorHelperSettings>();
+	if (!Settings->bWatchSourceFiles)
+	{
+		return;
+	}
+
+	IDirectoryWatcher* DirectoryWatcher = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")).Get();
+	if (!DirectoryWatcher)
+	{
+		UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 当前平台不支持目录监视，监视模式未启用"));
+		return;
+	}
+
+	// ExcelPath 与 JsonPath 可能是同一目录，只注册一次；回调按扩展名区分文件类型
+	TArray<FString> Directories;
+	for (const FString& Path : { Settings->ExcelPath, Settings->JsonPath })
+	{
+		if (Path.IsEmpty())
+		{
+			continue;
+		}
+		const FString Directory = ToWatchDirectory(Path);
+		if (!FPaths::DirectoryExists(Directory))
+		{
+			UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 监视模式：目录不存在，已跳过 %s"), *Directory);
+			continue;
+		}
+		if (!Directories.ContainsByPredicate([&Directory](const FString& Existing) { return FPaths::IsSamePath(Existing, Directory); }))
+		{
+			Directories.Add(Directory);
+		}
+	}
+
+	for (const FString& Directory : Directories)
+	{
+		FWatchedDirectory& Watched = WatchedDirectories.AddDefaulted_GetRef();
+		Watched.Directory = Directory;
+		DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+			Directory,
+			IDirectoryWatcher::FDirectoryChanged::CreateUObject(this, &UAbilityEditorHelperSubsystem::OnSourceDirectoryChanged),
+			Watched.Handle);
+		UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 监视模式：正在监视 %s"), *Directory);
+	}
+#endif
+}
+
+void UAbilityEditorHelperSubsystem::StopWatchingSourceFiles()
+{
+#if WITH_EDITOR
+	if (WatchedDirectories.Num() > 0)
+	{
+		if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+		{
+			if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+			{
+				for (const FWatchedDirectory& Watched : WatchedDirectories)
+				{
+					DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(Watched.Directory, Watched.Handle);
+				}
+			}
+		}
+		WatchedDirectories.Empty();
+	}
+
+	if (PendingSourceTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PendingSourceTickerHandle);
+		PendingSourceTickerHandle.Reset();
+	}
+	for (FPendingSourceChange& Pending : PendingSourceChanges)
+	{
+		Pending = FPendingSourceChange();
+	}
+#endif
+}
+
+void UAbilityEditorHelperSubsystem::OnSourceDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+#if WITH_EDITOR
+	const UAbilityEditorHelperSettings* Settings = GetDefault<UAbilityEditorHelperSettings>();
+	const FString ExcelDirectory = ToWatchDirectory(Settings->ExcelPath);
+	const FString JsonDirectory = ToWatchDirectory(Settings->JsonPath);
+	const double Now = FPlatformTime::Seconds();
+
+	bool bAnyPending = false;
+	for (const FFileChangeData& Change : Changes)
+	{
+		// 删除不触发导入；Excel 保存时的临时文件（~$ 前缀）因基础名不匹配自然被忽略
+		if (Change.Action == FFileChangeData::FCA_Removed)
+		{
+			continue;
+		}
+
+		const FString BaseName = FPaths::GetBaseFilename(Change.Filename);
+		const FString Directory = FPaths::GetPath(Change.Filename);
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(PendingSourceChanges); ++Index)
+		{
+			const FString SourceBaseName = GetSourceBaseName(Settings, static_cast<EAbilityEditorGenerationTarget>(Index));
+			if (SourceBaseName.IsEmpty() || !BaseName.Equals(SourceBaseName, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+
+			FPendingSourceChange& Pending = PendingSourceChanges[Index];
+			if (FAbilityEditorSpreadsheetRowReader::IsSpreadsheetFile(Change.Filename) && FPaths::IsSamePath(Directory, ExcelDirectory))
+			{
+				Pending.bExcelChanged = true;
+				Pending.ChangedExcelFile = Change.Filename;
+			}
+			else if ((FPaths::GetExtension(Change.Filename).Equals(TEXT("json"), ESearchCase::IgnoreCase) || FAbilityEditorBinaryRowReader::IsBinaryRowFile(Change.Filename))
+				&& FPaths::IsSamePath(Directory, JsonDirectory))
+			{
+				Pending.bJsonChanged = true;
+				Pending.ChangedJsonFile = Change.Filename;
+			}
+			else
+			{
+				continue;
+			}
+			Pending.LastChangeTime = Now;
+			bAnyPending = true;
+		}
+	}
+
+	if (bAnyPending && !PendingSourceTickerHandle.IsValid())
+	{
+		PendingSourceTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UAbilityEditorHelperSubsystem::TickPendingSourceChanges), 0.2f);
+	}
+#endif
+}
+
+bool UAbilityEditorHelperSubsystem::TickPendingSourceChanges(float DeltaTime)
+{
+#if WITH_EDITOR
+	const UAbilityEditorHelperSettings* Settings = GetDefault<UAbilityEditorHelperSettings>();
+	const double Now = FPlatformTime::Seconds();
+
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(PendingSourceChanges); ++Index)
+	{
+		FPendingSourceChange& Pending = PendingSourceChanges[Index];
+		if (!Pending.IsPending() || Now - Pending.LastChangeTime < Settings->WatchDebounceSeconds)
+		{
+			continue;
+		}
+
+		// 同一时间只允许一个异步导入：等待正在进行的导入结束，不打断它
+		if (UAbilityEditorAsyncImport::IsAnyImportRunning())
+		{
+			break;
+		}
+
+		const EAbilityEditorGenerationTarget Target = static_cast<EAbilityEditorGenerationTarget>(Index);
+		const bool bFromExcel = Pending.bExcelChanged;
+		Pending.bExcelChanged = false;
+		Pending.bJsonChanged = false;
+
+		// 只导入变化的这张表：Excel 变化直接读取工作簿（不再经过 Python 导出 JSON），否则读取变化的 JSON / 二进制行文件；
+		// 数据读取与比较在工作线程进行，输入未变化时直接返回
+		UAbilityEditorAsyncImport* Import = nullptr;
+		if (bFromExcel)
+		{
+			const FString ExcelFileName = FPaths::GetCleanFilename(Pending.ChangedExcelFile);
+			UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 监视模式：%s 已变化，开始增量导入"), *ExcelFileName);
+			Import = Target == EAbilityEditorGenerationTarget::GameplayEffect
+				? UAbilityEditorAsyncImport::ImportAndUpdateGameplayEffectsFromExcelAsync(ExcelFileName, false)
+				: UAbilityEditorAsyncImport::ImportAndUpdateGameplayAbilitiesFromExcelAsync(ExcelFileName, false);
+		}
+		else
+		{
+			const FString JsonFileName = FPaths::GetCleanFilename(Pending.ChangedJsonFile);
+			UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 监视模式：%s 已变化，开始增量导入"), *JsonFileName);
+			Import = Target == EAbilityEditorGenerationTarget::GameplayEffect
+				? UAbilityEditorAsyncImport::ImportAndUpdateGameplayEffectsFromJsonAsync(JsonFileName, false)
+				: UAbilityEditorAsyncImport::ImportAndUpdateGameplayAbilitiesFromJsonAsync(JsonFileName, false);
+		}
+		Import->Activate();
+	}
+
+	for (const FPendingSourceChange& Pending : PendingSourceChanges)
+	{
+		if (Pending.IsPending())
+		{
+			return true;
+		}
+	}
+	PendingSourceTickerHandle.Reset();
+	return false;
+#else
+	return false;
+#endif
+}
+
+void UAbilityEditorHelperSubsystem::OnSettingsChanged(UObject* SettingsObject, FPropertyChangedEvent& PropertyChangedEvent)
+{
+#if WITH_EDITOR
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, bWatchSourceFiles)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, ExcelPath)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UAbilityEditorHelperSettings, JsonPath))
+	{
+		RefreshSourceFileWatchers();
+	}
+#endif
 }
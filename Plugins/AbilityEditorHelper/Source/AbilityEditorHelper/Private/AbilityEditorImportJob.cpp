@@ -0,0 +1,48 @@
+// AbilityEditorImportJob.cpp
+
+#include "AbilityEditorImportJob.h"
+#include "AbilityEditorBulkImportScope.h"
+#include "AbilityEditorTypes.h"
+
+bool FAbilityEditorImportJob::bAsyncImportRunning = false;
+
+bool FAbilityEditorImportJob::RunToCompletion()
+{
+	if (bAsyncImportRunning)
+	{
+		UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 异步导入正在进行，已拒绝 %s（可等待其完成或取消后重试）"), *GetDisplayName().ToString());
+		return false;
+	}
+
+	bool bSuccess = false;
+	if (!Prepare(bSuccess))
+	{
+		return bSuccess;
+	}
+
+	EAbilityEditorImportStepResult DataResult = EAbilityEditorImportStepResult::Continue;
+	while (DataResult == EAbilityEditorImportStepResult::Continue)
+	{
+		DataResult = ExecuteDataStep();
+	}
+	if (DataResult == EAbilityEditorImportStepResult::Failed)
+	{
+		return false;
+	}
+
+	// 批量导入作用域：资产注册表与脏包通知延迟到结束时统一刷新
+	FAbilityEditorBulkImportScope BulkImportScope;
+
+	if (!BeginAssetStage())
+	{
+		return false;
+	}
+
+	const int32 NumSteps = GetNumAssetSteps();
+	for (int32 StepIndex = 0; StepIndex < NumSteps; ++StepIndex)
+	{
+		ExecuteAssetStep(StepIndex);
+	}
+
+	return Finish(BulkImportScope, NumSteps);
+}
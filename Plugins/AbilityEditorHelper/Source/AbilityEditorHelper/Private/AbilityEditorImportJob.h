@@ -0,0 +1,100 @@
+// AbilityEditorImportJob.h
+// 可分步执行的导入任务（同步导入接口与异步导入共用同一份实现）
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+class FAbilityEditorBulkImportScope;
+
+/** 导入任务分步执行的结果 */
+enum class EAbilityEditorImportStepResult : uint8
+{
+	/** 阶段尚未完成，需要继续调用 */
+	Continue,
+	/** 阶段已完成 */
+	Done,
+	/** 失败，任务直接结束 */
+	Failed,
+};
+
+/**
+ * 可分步执行的导入任务
+ * 执行顺序：
+ * 1. Prepare（游戏线程）：校验输入、比较输入指纹；返回 false 表示无需继续，bOutSuccess 即最终结果
+ * 2. ExecuteDataStep（纯数据阶段，反复调用直到 Done）：CanRunDataStageOffGameThread 为 true 时可在工作线程执行
+ * 3. BeginAssetStage（游戏线程，批量导入作用域内）：写回 DataTable、清理目录，确定逐行步骤
+ * 4. ExecuteAssetStep（游戏线程，批量导入作用域内）：生成一个资产
+ * 5. Finish（游戏线程，最外层批量导入作用域内）：保存包、写回清单与指纹
+ * 同步接口通过 RunToCompletion 在一个批量导入作用域内依次执行全部阶段；
+ * 异步导入（UAbilityEditorAsyncImport）把数据阶段放到工作线程，把逐行步骤按帧预算分摊到多帧，并可在两行之间取消
+ */
+class FAbilityEditorImportJob : public FGCObject
+{
+public:
+	virtual ~FAbilityEditorImportJob() = default;
+
+	/** 任务名称（通知与日志使用） */
+	virtual FText GetDisplayName() const = 0;
+
+	/** @return 需要继续执行后续阶段时返回 true */
+	virtual bool Prepare(bool& bOutSuccess) = 0;
+
+	/** 数据阶段是否不访问任何 UObject（所需数据已在 Prepare 中于游戏线程取得快照）、可在工作线程执行 */
+	virtual bool CanRunDataStageOffGameThread() const { return false; }
+
+	/** 执行数据阶段的下一批 */
+	virtual EAbilityEditorImportStepResult ExecuteDataStep() { return EAbilityEditorImportStepResult::Done; }
+
+	/** @return 失败时返回 false，任务直接结束（不调用 Finish） */
+	virtual bool BeginAssetStage() { return true; }
+
+	/** 逐行步骤数（BeginAssetStage 之后有效） */
+	virtual int32 GetNumAssetSteps() const = 0;
+
+	virtual void ExecuteAssetStep(int32 StepIndex) = 0;
+
+	/**
+	 * 结束导入
+	 * @param Scope         最外层批量导入作用域（保存本次新建或变化的包）
+	 * @param NumStepsDone  已执行的逐行步骤数；取消时小于 GetNumAssetSteps，未执行的行不计入清单与指纹
+	 * @return              全部成功返回 true（被取消时返回 false）
+	 */
+	virtual bool Finish(FAbilityEditorBulkImportScope& Scope, int32 NumStepsDone) = 0;
+
+	/** 本次新增或变化的行（JSON 导入任务在数据阶段之后有效，其他任务为空） */
+	virtual TArray<FName> GetUpdatedRowNames() const { return TArray<FName>(); }
+
+	/** 允许在逐行步骤之间取消（异步导入开始前调用）；需要为取消保留额外状态的任务据此决定是否保留 */
+	void EnableCancellation() { bCancellable = true; }
+
+	/** 在当前线程依次执行全部阶段（同步接口使用）；有异步导入在进行时拒绝执行 */
+	bool RunToCompletion();
+
+	// ===== 工厂（实现位于 AbilityEditorHelperLibrary.cpp，与同步接口共用；RowType 为已注册的行类型名称，见 FAbilityEditorRowAssetTypeRegistry） =====
+
+	/** 单张 DataTable 的批量生成，等价于 CreateOrUpdateRowTypeAssets */
+	static TSharedRef<FAbilityEditorImportJob> MakeTableGenerationJob(FName RowType, bool bClearFolderFirst, bool bForceFullUpdate);
+
+	/** 多个行类型按依赖顺序统一生成，等价于 CreateOrUpdateRowTypesAssets（GE + GA 即 CreateOrUpdateGameplayEffectsAndAbilitiesFromSettings） */
+	static TSharedRef<FAbilityEditorImportJob> MakeUnifiedGenerationJob(const TArray<FName>& RowTypes, bool bClearFoldersFirst, bool bForceFullUpdate);
+
+	/** JSON 增量导入，等价于 ImportAndUpdateRowTypeFromJson */
+	static TSharedRef<FAbilityEditorImportJob> MakeJsonImportJob(FName RowType, const FString& JsonFileName, bool bClearFolderFirst);
+
+	/** xlsx / CSV 增量导入（原生读取），等价于 ImportAndUpdateRowTypeFromExcel */
+	static TSharedRef<FAbilityEditorImportJob> MakeExcelImportJob(FName RowType, const FString& ExcelFileName, bool bClearFolderFirst);
+
+	/** 当前是否有异步导入在进行（期间同步导入与新的异步导入都会被拒绝） */
+	static bool IsAsyncImportRunning() { return bAsyncImportRunning; }
+
+	/** 由异步导入在开始与结束时设置 */
+	static void SetAsyncImportRunning(bool bRunning) { bAsyncImportRunning = bRunning; }
+
+protected:
+	bool bCancellable = false;
+
+private:
+	static bool bAsyncImportRunning;
+};
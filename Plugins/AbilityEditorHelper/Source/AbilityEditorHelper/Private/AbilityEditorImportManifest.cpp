@@ -0,0 +1,125 @@
+// AbilityEditorImportManifest.cpp
+
+#include "AbilityEditorImportManifest.h"
+#include "AbilityEditorTypes.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+FString FAbilityEditorImportManifest::GetManifestFilePath(const UDataTable* DataTable)
+{
+	const FString FileName = FPaths::MakeValidFileName(DataTable ? DataTable->GetPathName() : FString(), TEXT('_'));
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AbilityEditorHelper"), TEXT("Manifests"), FileName + TEXT(".json"));
+}
+
+bool FAbilityEditorImportManifest::Load(const UDataTable* DataTable, const FString& InSchemaHash, FAbilityEditorImportManifest& OutManifest)
+{
+	OutManifest = FAbilityEditorImportManifest();
+	if (!DataTable || !DataTable->GetRowStruct())
+	{
+		return false;
+	}
+
+	const FString FilePath = GetManifestFilePath(DataTable);
+	FString JsonString;
+	if (!FPaths::FileExists(FilePath) || !FFileHelper::LoadFileToString(JsonString, *FilePath))
+	{
+		return false;
+	}
+
+	FAbilityEditorImportManifest Loaded;
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &Loaded, 0, 0))
+	{
+		UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 增量清单解析失败，将按全量比较处理：%s"), *FilePath);
+		return false;
+	}
+
+	if (Loaded.Version != CurrentVersion
+		|| Loaded.RowStructPath != DataTable->GetRowStruct()->GetPathName()
+		|| Loaded.SchemaHash != InSchemaHash)
+	{
+		UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 增量清单已过期（版本或行结构变化），将按全量比较处理：%s"), *FilePath);
+		return false;
+	}
+
+	OutManifest = MoveTemp(Loaded);
+	OutManifest.RebuildRowIndex();
+	return true;
+}
+
+void FAbilityEditorImportManifest::Delete(const UDataTable* DataTable)
+{
+	const FString FilePath = GetManifestFilePath(DataTable);
+	if (FPaths::FileExists(FilePath))
+	{
+		IFileManager::Get().Delete(*FilePath);
+	}
+}
+
+void FAbilityEditorImportManifest::ResetHeader(const UDataTable* DataTable, const FString& InSchemaHash)
+{
+	*this = FAbilityEditorImportManifest();
+	Version = CurrentVersion;
+	DataTablePath = DataTable ? DataTable->GetPathName() : FString();
+	RowStructPath = (DataTable && DataTable->GetRowStruct()) ? DataTable->GetRowStruct()->GetPathName() : FString();
+	SchemaHash = InSchemaHash;
+}
+
+bool FAbilityEditorImportManifest::Save(const UDataTable* DataTable) const
+{
+	FString JsonString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(*this, JsonString))
+	{
+		return false;
+	}
+
+	const FString FilePath = GetManifestFilePath(DataTable);
+	if (!FFileHelper::SaveStringToFile(JsonString, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 无法写入增量清单：%s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+const FAbilityEditorManifestRow* FAbilityEditorImportManifest::FindRow(FName RowName) const
+{
+	const int32* Index = RowIndex.Find(RowName);
+	return Index ? &Rows[*Index] : nullptr;
+}
+
+FAbilityEditorManifestRow& FAbilityEditorImportManifest::FindOrAddRow(FName RowName)
+{
+	if (const int32* Index = RowIndex.Find(RowName))
+	{
+		return Rows[*Index];
+	}
+
+	const int32 NewIndex = Rows.AddDefaulted();
+	Rows[NewIndex].RowName = RowName;
+	RowIndex.Add(RowName, NewIndex);
+	return Rows[NewIndex];
+}
+
+FString FAbilityEditorImportManifest::HashToString(uint64 Hash)
+{
+	return FString::Printf(TEXT("%016llx"), Hash);
+}
+
+uint64 FAbilityEditorImportManifest::StringToHash(const FString& HashString)
+{
+	return HashString.IsEmpty() ? 0 : FParse::HexNumber64(*HashString);
+}
+
+void FAbilityEditorImportManifest::RebuildRowIndex()
+{
+	RowIndex.Reset();
+	RowIndex.Reserve(Rows.Num());
+	for (int32 Index = 0; Index < Rows.Num(); ++Index)
+	{
+		RowIndex.Add(Rows[Index].RowName, Index);
+	}
+}
@@ -0,0 +1,119 @@
+// AbilityEditorImportReport.cpp
+
+#include "AbilityEditorImportReport.h"
+#include "AbilityEditorTypes.h"
+#include "Engine/DataTable.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	/** 路径以 TStringBuilder 逐层追加与回退，只在记录变化时生成 FString */
+	using FFieldPath = TStringBuilder<256>;
+
+	void DiffStruct(const UStruct* Struct, const void* OldData, const void* NewData, FFieldPath& Path, TArray<FString>& OutChangedFields);
+
+	void AppendIndex(FFieldPath& Path, int32 Index)
+	{
+		Path << TEXT('[') << Index << TEXT(']');
+	}
+
+	void DiffValue(const FProperty* Property, const void* OldValue, const void* NewValue, FFieldPath& Path, TArray<FString>& OutChangedFields)
+	{
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper OldArray(ArrayProperty, OldValue);
+			FScriptArrayHelper NewArray(ArrayProperty, NewValue);
+			const int32 CommonNum = FMath::Min(OldArray.Num(), NewArray.Num());
+			const int32 MaxNum = FMath::Max(OldArray.Num(), NewArray.Num());
+			const int32 PathLen = Path.Len();
+			for (int32 Index = 0; Index < MaxNum; ++Index)
+			{
+				AppendIndex(Path, Index);
+				if (Index < CommonNum)
+				{
+					DiffValue(ArrayProperty->Inner, OldArray.GetRawPtr(Index), NewArray.GetRawPtr(Index), Path, OutChangedFields);
+				}
+				else
+				{
+					OutChangedFields.Emplace(Path.ToView());
+				}
+				Path.RemoveSuffix(Path.Len() - PathLen);
+			}
+			return;
+		}
+
+		// 没有原生比较的结构体按成员展开；带原生比较的（如 FGameplayTagContainer）整体比较
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if (!(StructProperty->Struct->StructFlags & STRUCT_IdenticalNative))
+			{
+				const int32 PathLen = Path.Len();
+				Path << TEXT('.');
+				DiffStruct(StructProperty->Struct, OldValue, NewValue, Path, OutChangedFields);
+				Path.RemoveSuffix(Path.Len() - PathLen);
+				return;
+			}
+		}
+
+		if (!Property->Identical(OldValue, NewValue, PPF_None))
+		{
+			OutChangedFields.Emplace(Path.ToView());
+		}
+	}
+
+	void DiffStruct(const UStruct* Struct, const void* OldData, const void* NewData, FFieldPath& Path, TArray<FString>& OutChangedFields)
+	{
+		const int32 PathLen = Path.Len();
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			const FProperty* Property = *It;
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				Path << Property->GetAuthoredName();
+				if (Property->ArrayDim > 1)
+				{
+					AppendIndex(Path, ArrayIndex);
+				}
+				DiffValue(Property, Property->ContainerPtrToValuePtr<void>(OldData, ArrayIndex), Property->ContainerPtrToValuePtr<void>(NewData, ArrayIndex), Path, OutChangedFields);
+				Path.RemoveSuffix(Path.Len() - PathLen);
+			}
+		}
+	}
+}
+
+void FAbilityEditorStructDiff::CollectChangedFields(const UStruct* Struct, const void* OldData, const void* NewData, TArray<FString>& OutChangedFields)
+{
+	if (!Struct || !OldData || !NewData)
+	{
+		return;
+	}
+
+	FFieldPath Path;
+	DiffStruct(Struct, OldData, NewData, Path, OutChangedFields);
+}
+
+FString FAbilityEditorImportReport::GetReportFilePath(const UDataTable* DataTable)
+{
+	const FString FileName = FPaths::MakeValidFileName(DataTable ? DataTable->GetPathName() : FString(), TEXT('_'));
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AbilityEditorHelper"), TEXT("Reports"), TEXT("Import_") + FileName + TEXT(".json"));
+}
+
+bool FAbilityEditorImportReport::Save(const UDataTable* DataTable) const
+{
+	FString JsonString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(*this, JsonString, 0, 0, 0, nullptr, false))
+	{
+		return false;
+	}
+
+	const FString FilePath = GetReportFilePath(DataTable);
+	if (!FFileHelper::SaveStringToFile(JsonString, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogAbilityEditor, Warning, TEXT("[AbilityEditorHelper] 无法写入导入报告：%s"), *FilePath);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,682 @@
+// AbilityEditorJsonRowReader.cpp
+
+#include "AbilityEditorJsonRowReader.h"
+#include "AbilityEditorTypes.h"
+#include "Hash/xxhash.h"
+#include "Serialization/JsonReader.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+
+namespace
+{
+	/** 绑定时是否可能触发对象加载（硬引用对象/类属性） */
+	static bool IsHardObjectReference(const FProperty* Property)
+	{
+		return CastField<FObjectPropertyBase>(Property) && !CastField<FSoftObjectProperty>(Property);
+	}
+
+	static FString DescribeToken(const FAbilityEditorJsonToken& Token)
+	{
+		switch (Token.Notation)
+		{
+		case EJsonNotation::ObjectStart: return TEXT("Object");
+		case EJsonNotation::ArrayStart: return TEXT("Array");
+		case EJsonNotation::String: return FString::Printf(TEXT("String \"%s\""), *Token.Value);
+		case EJsonNotation::Number: return FString::Printf(TEXT("Number %s"), *Token.Value);
+		case EJsonNotation::Boolean: return Token.bBoolean ? TEXT("true") : TEXT("false");
+		case EJsonNotation::Null: return TEXT("null");
+		default: return TEXT("?");
+		}
+	}
+}
+
+// ===================== FAbilityEditorJsonRow =====================
+
+uint64 FAbilityEditorJsonRow::ComputeSourceHash() const
+{
+	FXxHash64Builder Builder;
+	auto HashString = [&Builder](const FString& Value)
+	{
+		const int32 Len = Value.Len();
+		Builder.Update(&Len, sizeof(Len));
+		Builder.Update(*Value, Len * sizeof(TCHAR));
+	};
+
+	for (const FAbilityEditorJsonToken& Token : Tokens)
+	{
+		const uint8 Notation = static_cast<uint8>(Token.Notation);
+		Builder.Update(&Notation, sizeof(Notation));
+		HashString(Token.Identifier);
+
+		if (Token.Notation == EJsonNotation::Boolean)
+		{
+			const uint8 Value = Token.bBoolean ? 1 : 0;
+			Builder.Update(&Value, sizeof(Value));
+		}
+		else if (Token.Notation == EJsonNotation::String || Token.Notation == EJsonNotation::Number)
+		{
+			HashString(Token.Value);
+		}
+	}
+	return Builder.Finalize().Hash;
+}
+
+// ===================== FAbilityEditorJsonTokenWriter =====================
+
+void FAbilityEditorJsonTokenWriter::Integer(const FString& Key, int64 Value)
+{
+	FAbilityEditorJsonToken& Token = Add(EJsonNotation::Number, Key);
+	Token.Number = static_cast<double>(Value);
+	Token.Value = LexToString(Value);
+}
+
+void FAbilityEditorJsonTokenWriter::Float(const FString& Key, double Value)
+{
+	FAbilityEditorJsonToken& Token = Add(EJsonNotation::Number, Key);
+	Token.Number = Value;
+	Token.Value = FormatFloat(Value);
+}
+
+bool FAbilityEditorJsonTokenWriter::JsonObject(const FString& Key, const FString& JsonText)
+{
+	const int32 StartNum = Tokens.Num();
+	const TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(JsonText);
+
+	int32 Depth = 0;
+	EJsonNotation Notation;
+	while (Reader->ReadNext(Notation) && Notation != EJsonNotation::Error)
+	{
+		FAbilityEditorJsonToken& Token = Add(Notation, Tokens.Num() == StartNum ? Key : Reader->GetIdentifier());
+		if (Notation == EJsonNotation::String)
+		{
+			Token.Value = Reader->GetValueAsString();
+		}
+		else if (Notation == EJsonNotation::Number)
+		{
+			Token.Number = Reader->GetValueAsNumber();
+			Token.Value = Reader->GetValueAsNumberString();
+		}
+		else if (Notation == EJsonNotation::Boolean)
+		{
+			Token.bBoolean = Reader->GetValueAsBoolean();
+		}
+
+		Depth += (Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart) ? 1 : 0;
+		Depth -= (Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd) ? 1 : 0;
+		if (Depth == 0)
+		{
+			if (Tokens[StartNum].Notation == EJsonNotation::ObjectStart)
+			{
+				return true;
+			}
+			break;
+		}
+	}
+
+	Tokens.SetNum(StartNum);
+	return false;
+}
+
+void FAbilityEditorJsonTokenWriter::TagContainer(const FString& Key, const TArray<FString>& Tags)
+{
+	// 父 Tag：GameplayCue.Test.A -> GameplayCue、GameplayCue.Test（区分大小写去重，按字符序排序）
+	TArray<FString> ParentTags;
+	for (const FString& Tag : Tags)
+	{
+		int32 DotIndex = INDEX_NONE;
+		int32 SearchFrom = 0;
+		while ((DotIndex = Tag.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchFrom)) != INDEX_NONE)
+		{
+			FString Parent = Tag.Left(DotIndex);
+			if (!ParentTags.ContainsByPredicate([&Parent](const FString& Existing) { return Existing.Equals(Parent, ESearchCase::CaseSensitive); }))
+			{
+				ParentTags.Add(MoveTemp(Parent));
+			}
+			SearchFrom = DotIndex + 1;
+		}
+	}
+	ParentTags.Sort([](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::CaseSensitive) < 0; });
+
+	BeginObject(Key);
+	for (const TArray<FString>* List : { &Tags, &ParentTags })
+	{
+		BeginArray(List == &Tags ? TEXT("GameplayTags") : TEXT("ParentTags"));
+		for (const FString& Tag : *List)
+		{
+			BeginObject(FString());
+			String(TEXT("TagName"), Tag);
+			EndObject();
+		}
+		EndArray();
+	}
+	EndObject();
+}
+
+FString FAbilityEditorJsonTokenWriter::FormatFloat(double Value)
+{
+	FString Text = FString::Printf(TEXT("%.15g"), Value);
+	if (FCString::Atod(*Text) != Value)
+	{
+		Text = FString::Printf(TEXT("%.16g"), Value);
+		if (FCString::Atod(*Text) != Value)
+		{
+			Text = FString::Printf(TEXT("%.17g"), Value);
+		}
+	}
+
+	int32 Index;
+	if (FMath::IsFinite(Value) && !Text.FindChar(TEXT('.'), Index) && !Text.FindChar(TEXT('e'), Index))
+	{
+		Text += TEXT(".0");
+	}
+	return Text;
+}
+
+// ===================== FAbilityEditorJsonRowReader =====================
+
+FAbilityEditorJsonRowReader::FAbilityEditorJsonRowReader() = default;
+
+FAbilityEditorJsonRowReader::~FAbilityEditorJsonRowReader()
+{
+	// 先释放引用文件内容的解析器
+	JsonReader.Reset();
+}
+
+bool FAbilityEditorJsonRowReader::OpenFile(const FString& FilePath)
+{
+	FString OpenError;
+	if (!File.Open(FilePath, OpenError))
+	{
+		return SetError(OpenError);
+	}
+	if (File.GetSize() > MAX_int32)
+	{
+		return SetError(FString::Printf(TEXT("JSON 文件超过 2GB，无法读取：%s"), *FilePath));
+	}
+
+	// 直接在映射的 UTF-8 字节上解析，不再整体转换为 UTF-16
+	JsonReader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(File.GetUtf8Text());
+
+	EJsonNotation Notation;
+	if (!JsonReader->ReadNext(Notation) || Notation != EJsonNotation::ArrayStart)
+	{
+		return SetError(TEXT("JSON 根节点不是数组"));
+	}
+	return true;
+}
+
+bool FAbilityEditorJsonRowReader::ReadNextRow(FAbilityEditorJsonRow& OutRow)
+{
+	OutRow.Reset();
+	if (bFinished || HasError() || !JsonReader.IsValid())
+	{
+		return false;
+	}
+
+	EJsonNotation Notation;
+	while (true)
+	{
+		if (!JsonReader->ReadNext(Notation))
+		{
+			return SetError(JsonReader->GetErrorMessage());
+		}
+
+		if (Notation == EJsonNotation::ArrayEnd)
+		{
+			// 根数组结束；不再继续调用 ReadNext，避免尾随空白被视为多余输入
+			bFinished = true;
+			return false;
+		}
+
+		if (Notation == EJsonNotation::ObjectStart)
+		{
+			break;
+		}
+
+		// 根数组中的非对象元素：与原实现一致，直接忽略
+		if (Notation == EJsonNotation::ArrayStart)
+		{
+			int32 Depth = 1;
+			while (Depth > 0)
+			{
+				if (!JsonReader->ReadNext(Notation))
+				{
+					return SetError(JsonReader->GetErrorMessage());
+				}
+				Depth += (Notation == EJsonNotation::ArrayStart || Notation == EJsonNotation::ObjectStart) ? 1 : 0;
+				Depth -= (Notation == EJsonNotation::ArrayEnd || Notation == EJsonNotation::ObjectEnd) ? 1 : 0;
+			}
+		}
+	}
+
+	AppendCurrentToken(Notation, OutRow);
+
+	int32 Depth = 1;
+	while (Depth > 0)
+	{
+		if (!JsonReader->ReadNext(Notation) || Notation == EJsonNotation::Error)
+		{
+			return SetError(JsonReader->GetErrorMessage());
+		}
+
+		AppendCurrentToken(Notation, OutRow);
+
+		if (Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart)
+		{
+			++Depth;
+		}
+		else if (Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd)
+		{
+			--Depth;
+		}
+		else if (Depth == 1 && OutRow.Tokens.Last().Identifier == TEXT("Name"))
+		{
+			// 行名只取顶层 Name 字段（与 TryGetStringField 一致：数字也视为字符串）
+			const FAbilityEditorJsonToken& NameToken = OutRow.Tokens.Last();
+			if (NameToken.Notation == EJsonNotation::String || NameToken.Notation == EJsonNotation::Number)
+			{
+				OutRow.Name = NameToken.Value;
+			}
+		}
+	}
+	return true;
+}
+
+void FAbilityEditorJsonRowReader::AppendCurrentToken(EJsonNotation Notation, FAbilityEditorJsonRow& OutRow) const
+{
+	FAbilityEditorJsonToken& Token = OutRow.Tokens.AddDefaulted_GetRef();
+	Token.Notation = Notation;
+	Token.Identifier = JsonReader->GetIdentifier();
+
+	switch (Notation)
+	{
+	case EJsonNotation::String:
+		Token.Value = JsonReader->GetValueAsString();
+		break;
+	case EJsonNotation::Number:
+		Token.Number = JsonReader->GetValueAsNumber();
+		Token.Value = JsonReader->GetValueAsNumberString();
+		break;
+	case EJsonNotation::Boolean:
+		Token.bBoolean = JsonReader->GetValueAsBoolean();
+		break;
+	default:
+		break;
+	}
+}
+
+bool FAbilityEditorJsonRowReader::SetError(const FString& InMessage)
+{
+	ErrorMessage = InMessage.IsEmpty() ? TEXT("JSON 解析失败，格式不正确") : InMessage;
+	return false;
+}
+
+// ===================== FAbilityEditorJsonRowBinder =====================
+
+FAbilityEditorJsonRowBinder::FAbilityEditorJsonRowBinder(const UScriptStruct* InRowStruct)
+	: RowStruct(InRowStruct)
+{
+	if (RowStruct)
+	{
+		BuildPropertyIndex(RowStruct);
+	}
+}
+
+void FAbilityEditorJsonRowBinder::BuildPropertyIndex(const UStruct* Struct)
+{
+	if (!Struct || PropertyIndex.Contains(Struct))
+	{
+		return;
+	}
+
+	TMap<FString, const FProperty*>& Properties = PropertyIndex.Add(Struct);
+	TArray<const UStruct*> NestedStructs;
+
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		const FProperty* Property = *It;
+		Properties.Add(Property->GetAuthoredName(), Property);
+
+		// 收集容器内部/嵌套结构体，递归建立索引
+		TArray<const FProperty*, TInlineAllocator<2>> ValueProperties;
+		ValueProperties.Add(Property);
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			ValueProperties.Add(ArrayProperty->Inner);
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			ValueProperties.Add(SetProperty->ElementProp);
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			ValueProperties.Add(MapProperty->ValueProp);
+		}
+
+		for (const FProperty* ValueProperty : ValueProperties)
+		{
+			if (IsHardObjectReference(ValueProperty))
+			{
+				bRequiresGameThread = true;
+			}
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(ValueProperty))
+			{
+				NestedStructs.Add(StructProperty->Struct);
+			}
+		}
+	}
+
+	// Properties 引用在后续 Add 时可能失效，递归放在最后
+	for (const UStruct* NestedStruct : NestedStructs)
+	{
+		BuildPropertyIndex(NestedStruct);
+	}
+}
+
+bool FAbilityEditorJsonRowBinder::BindRow(const FAbilityEditorJsonRow& Row, void* RowData, FString& OutError) const
+{
+	if (!RowStruct || !RowData || Row.Tokens.Num() == 0 || Row.Tokens[0].Notation != EJsonNotation::ObjectStart)
+	{
+		OutError = TEXT("行数据不是 JSON 对象");
+		return false;
+	}
+
+	int32 Cursor = 0;
+	return BindStruct(RowStruct, RowData, Row.Tokens, Cursor, OutError);
+}
+
+bool FAbilityEditorJsonRowBinder::BindStruct(const UStruct* Struct, void* StructData, const TArray<FAbilityEditorJsonToken>& Tokens, int32& Cursor, FString& OutError) const
+{
+	const TMap<FString, const FProperty*>* Properties = PropertyIndex.Find(Struct);
+	check(Properties);
+
+	// 跳过 ObjectStart
+	++Cursor;
+
+	while (Cursor < Tokens.Num() && Tokens[Cursor].Notation != EJsonNotation::ObjectEnd)
+	{
+		const FAbilityEditorJsonToken& Token = Tokens[Cursor];
+		const FProperty* const* FoundProperty = Properties->Find(Token.Identifier);
+		if (!FoundProperty)
+		{
+			// 未知字段直接忽略（与 JsonObjectToUStruct 一致）
+			SkipValue(Tokens, Cursor);
+			continue;
+		}
+
+		const FProperty* Property = *FoundProperty;
+		if (Property->ArrayDim > 1 && Token.Notation == EJsonNotation::ArrayStart)
+		{
+			// 静态数组：按元素依次写入
+			++Cursor;
+			int32 ElementIndex = 0;
+			while (Cursor < Tokens.Num() && Tokens[Cursor].Notation != EJsonNotation::ArrayEnd)
+			{
+				if (ElementIndex < Property->ArrayDim)
+				{
+					if (!BindValue(Property, Property->ContainerPtrToValuePtr<void>(StructData, ElementIndex), Tokens, Cursor, OutError))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					SkipValue(Tokens, Cursor);
+				}
+				++ElementIndex;
+			}
+			++Cursor;
+			continue;
+		}
+
+		if (!BindValue(Property, Property->ContainerPtrToValuePtr<void>(StructData), Tokens, Cursor, OutError))
+		{
+			return false;
+		}
+	}
+
+	// 跳过 ObjectEnd
+	++Cursor;
+	return true;
+}
+
+bool FAbilityEditorJsonRowBinder::BindValue(const FProperty* Property, void* ValuePtr, const TArray<FAbilityEditorJsonToken>& Tokens, int32& Cursor, FString& OutError) const
+{
+	const FAbilityEditorJsonToken& Token = Tokens[Cursor];
+
+	auto Fail = [&]() -> bool
+	{
+		OutError = FString::Printf(TEXT("字段 %s 无法从 %s 导入"), *Property->GetAuthoredName(), *DescribeToken(Token));
+		return false;
+	};
+
+	// null 保持默认值
+	if (Token.Notation == EJsonNotation::Null)
+	{
+		++Cursor;
+		return true;
+	}
+
+	// ---- 容器 ----
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		if (Token.Notation != EJsonNotation::ArrayStart)
+		{
+			return Fail();
+		}
+
+		FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+		Helper.EmptyValues();
+		++Cursor;
+		while (Cursor < Tokens.Num() && Tokens[Cursor].Notation != EJsonNotation::ArrayEnd)
+		{
+			const int32 NewIndex = Helper.AddValue();
+			if (!BindValue(ArrayProperty->Inner, Helper.GetRawPtr(NewIndex), Tokens, Cursor, OutError))
+			{
+				return false;
+			}
+		}
+		++Cursor;
+		return true;
+	}
+
+	if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		if (Token.Notation != EJsonNotation::ArrayStart)
+		{
+			return Fail();
+		}
+
+		FScriptSetHelper Helper(SetProperty, ValuePtr);
+		Helper.EmptyElements();
+		++Cursor;
+		while (Cursor < Tokens.Num() && Tokens[Cursor].Notation != EJsonNotation::ArrayEnd)
+		{
+			const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+			if (!BindValue(SetProperty->ElementProp, Helper.GetElementPtr(NewIndex), Tokens, Cursor, OutError))
+			{
+				return false;
+			}
+		}
+		Helper.Rehash();
+		++Cursor;
+		return true;
+	}
+
+	if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		if (Token.Notation != EJsonNotation::ObjectStart)
+		{
+			return Fail();
+		}
+
+		FScriptMapHelper Helper(MapProperty, ValuePtr);
+		Helper.EmptyValues();
+		++Cursor;
+		while (Cursor < Tokens.Num() && Tokens[Cursor].Notation != EJsonNotation::ObjectEnd)
+		{
+			const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+			const FString& KeyText = Tokens[Cursor].Identifier;
+			if (!MapProperty->KeyProp->ImportText_Direct(*KeyText, Helper.GetKeyPtr(NewIndex), nullptr, PPF_None))
+			{
+				OutError = FString::Printf(TEXT("字段 %s 的键 %s 无法导入"), *Property->GetAuthoredName(), *KeyText);
+				return false;
+			}
+			if (!BindValue(MapProperty->ValueProp, Helper.GetValuePtr(NewIndex), Tokens, Cursor, OutError))
+			{
+				return false;
+			}
+		}
+		Helper.Rehash();
+		++Cursor;
+		return true;
+	}
+
+	// ---- 结构体 ----
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		if (Token.Notation == EJsonNotation::ObjectStart)
+		{
+			return BindStruct(StructProperty->Struct, ValuePtr, Tokens, Cursor, OutError);
+		}
+		if (Token.Notation == EJsonNotation::String)
+		{
+			// 字符串形式：走 ImportText（含自定义 ImportTextItem）
+			++Cursor;
+			return StructProperty->ImportText_Direct(*Token.Value, ValuePtr, nullptr, PPF_None) ? true : Fail();
+		}
+		return Fail();
+	}
+
+	if (Token.Notation == EJsonNotation::ObjectStart || Token.Notation == EJsonNotation::ArrayStart)
+	{
+		return Fail();
+	}
+
+	// 以下均为标量，统一在此前进游标
+	++Cursor;
+
+	// ---- 枚举 ----
+	const UEnum* Enum = nullptr;
+	const FNumericProperty* NumericProperty = nullptr;
+	if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		Enum = EnumProperty->GetEnum();
+		NumericProperty = EnumProperty->GetUnderlyingProperty();
+	}
+	else if ((NumericProperty = CastField<FNumericProperty>(Property)) != nullptr)
+	{
+		Enum = NumericProperty->GetIntPropertyEnum();
+	}
+
+	if (NumericProperty)
+	{
+		if (Enum && Token.Notation == EJsonNotation::String)
+		{
+			const int64 EnumValue = Enum->GetValueByNameString(Token.Value);
+			if (EnumValue == INDEX_NONE)
+			{
+				return Fail();
+			}
+			NumericProperty->SetIntPropertyValue(ValuePtr, EnumValue);
+			return true;
+		}
+
+		if (Token.Notation == EJsonNotation::String)
+		{
+			NumericProperty->SetNumericPropertyValueFromString(ValuePtr, *Token.Value);
+			return true;
+		}
+
+		if (Token.Notation != EJsonNotation::Number)
+		{
+			return Fail();
+		}
+
+		if (NumericProperty->IsFloatingPoint())
+		{
+			NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Token.Number);
+		}
+		else
+		{
+			// 优先按原始文本解析，避免 int64 经 double 丢失精度
+			int64 IntValue = 0;
+			if (!LexTryParseString(IntValue, *Token.Value))
+			{
+				IntValue = static_cast<int64>(Token.Number);
+			}
+			NumericProperty->SetIntPropertyValue(ValuePtr, IntValue);
+		}
+		return true;
+	}
+
+	// ---- 基础类型 ----
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		switch (Token.Notation)
+		{
+		case EJsonNotation::Boolean:
+			BoolProperty->SetPropertyValue(ValuePtr, Token.bBoolean);
+			return true;
+		case EJsonNotation::Number:
+			BoolProperty->SetPropertyValue(ValuePtr, Token.Number != 0.0);
+			return true;
+		case EJsonNotation::String:
+			BoolProperty->SetPropertyValue(ValuePtr, FCString::ToBool(*Token.Value));
+			return true;
+		default:
+			return Fail();
+		}
+	}
+
+	// 字符串类属性：数字/布尔也按文本写入（与 FJsonValue::AsString 一致）
+	const FString TextValue = Token.Notation == EJsonNotation::Boolean
+		? FString(Token.bBoolean ? TEXT("true") : TEXT("false"))
+		: Token.Value;
+
+	if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	{
+		StrProperty->SetPropertyValue(ValuePtr, TextValue);
+		return true;
+	}
+
+	if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	{
+		NameProperty->SetPropertyValue(ValuePtr, FName(*TextValue));
+		return true;
+	}
+
+	if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+	{
+		TextProperty->SetPropertyValue(ValuePtr, FText::FromString(TextValue));
+		return true;
+	}
+
+	// 其余（对象路径、软引用等）走 ImportText
+	if (Token.Notation == EJsonNotation::String)
+	{
+		return Property->ImportText_Direct(*Token.Value, ValuePtr, nullptr, PPF_None) ? true : Fail();
+	}
+
+	return Fail();
+}
+
+void FAbilityEditorJsonRowBinder::SkipValue(const TArray<FAbilityEditorJsonToken>& Tokens, int32& Cursor)
+{
+	int32 Depth = 0;
+	do
+	{
+		const EJsonNotation Notation = Tokens[Cursor].Notation;
+		if (Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart)
+		{
+			++Depth;
+		}
+		else if (Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd)
+		{
+			--Depth;
+		}
+		++Cursor;
+	}
+	while (Depth > 0 && Cursor < Tokens.Num());
+}
@@ -0,0 +1,182 @@
+// AbilityEditorJsonRowReader.h
+// 流式 JSON 行读取与反射绑定（替代 LoadFileToString + FJsonValue DOM + JsonObjectToUStruct）
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/JsonTypes.h"
+#include "AbilityEditorMappedFile.h"
+
+template <class CharType> class TJsonReader;
+
+/**
+ * 单个 JSON Token（记录 TJsonReader 读出的 Notation / Identifier / 值）
+ */
+struct FAbilityEditorJsonToken
+{
+	EJsonNotation Notation = EJsonNotation::Null;
+
+	/** 对象成员的键名（数组元素与结束符为空） */
+	FString Identifier;
+
+	/** String 的值，或 Number 的原始文本（用于无损解析 int64） */
+	FString Value;
+
+	double Number = 0.0;
+
+	bool bBoolean = false;
+};
+
+/**
+ * 一行数据（JSON 根数组中的一个对象）的全部 Token，首尾分别为 ObjectStart / ObjectEnd
+ */
+struct FAbilityEditorJsonRow
+{
+	/** 行名（对象中的 Name 字段） */
+	FString Name;
+
+	TArray<FAbilityEditorJsonToken> Tokens;
+
+	void Reset()
+	{
+		Name.Reset();
+		Tokens.Reset();
+	}
+
+	/** 源数据哈希：对 Token 序列做 xxHash64，无需绑定结构体即可判断该行 JSON 是否变化 */
+	uint64 ComputeSourceHash() const;
+};
+
+/**
+ * 按 TJsonReader 的约定向一行追加 Token（对象成员带键名，数组元素与结束符不带），
+ * 供非 JSON 的数据来源组装出与 JSON 行对象等价的 Token 序列（源数据哈希因此与 JSON 导入一致）
+ */
+class FAbilityEditorJsonTokenWriter
+{
+public:
+	explicit FAbilityEditorJsonTokenWriter(TArray<FAbilityEditorJsonToken>& InTokens)
+		: Tokens(InTokens)
+	{
+	}
+
+	void BeginObject(const FString& Key) { Add(EJsonNotation::ObjectStart, Key); }
+	void EndObject() { Add(EJsonNotation::ObjectEnd, FString()); }
+	void BeginArray(const FString& Key) { Add(EJsonNotation::ArrayStart, Key); }
+	void EndArray() { Add(EJsonNotation::ArrayEnd, FString()); }
+	void Null(const FString& Key) { Add(EJsonNotation::Null, Key); }
+	void String(const FString& Key, const FString& Value) { Add(EJsonNotation::String, Key).Value = Value; }
+	void Boolean(const FString& Key, bool bValue) { Add(EJsonNotation::Boolean, Key).bBoolean = bValue; }
+	void Integer(const FString& Key, int64 Value);
+	void Float(const FString& Key, double Value);
+
+	void EmptyObject(const FString& Key)
+	{
+		BeginObject(Key);
+		EndObject();
+	}
+
+	/**
+	 * 解析一段 JSON 对象文本并追加其 Token
+	 * @return 格式错误或不是对象时不写入任何 Token 并返回 false
+	 */
+	bool JsonObject(const FString& Key, const FString& JsonText);
+
+	/** FGameplayTagContainer 的 JSON 形式：GameplayTags 按给定顺序，ParentTags 为全部父 Tag 去重后排序 */
+	void TagContainer(const FString& Key, const TArray<FString>& Tags);
+
+	/** 浮点数的 JSON 文本：最短可往返的表示，整数值补 ".0"（与 Python json 模块写出的一致） */
+	static FString FormatFloat(double Value);
+
+private:
+	FAbilityEditorJsonToken& Add(EJsonNotation Notation, const FString& Key)
+	{
+		FAbilityEditorJsonToken& Token = Tokens.AddDefaulted_GetRef();
+		Token.Notation = Notation;
+		Token.Identifier = Key;
+		return Token;
+	}
+
+	TArray<FAbilityEditorJsonToken>& Tokens;
+};
+
+/**
+ * 行数据来源：逐行产出与 JSON 行对象等价的 Token 序列，增量导入按批读取后并行绑定与比较
+ * 实现：FAbilityEditorJsonRowReader（JSON 文件）、FAbilityEditorSpreadsheetRowReader（xlsx / CSV 目录）、FAbilityEditorBinaryRowReader（二进制行文件）
+ */
+class FAbilityEditorRowSource
+{
+public:
+	virtual ~FAbilityEditorRowSource() = default;
+
+	/**
+	 * 读取下一行对象
+	 * @return 读到一行返回 true；到达末尾或出错返回 false（通过 HasError 区分）
+	 */
+	virtual bool ReadNextRow(FAbilityEditorJsonRow& OutRow) = 0;
+
+	bool HasError() const { return !ErrorMessage.IsEmpty(); }
+
+	const FString& GetErrorMessage() const { return ErrorMessage; }
+
+protected:
+	FString ErrorMessage;
+};
+
+/**
+ * 流式读取 "对象数组" 格式的 JSON 文件
+ * 文件以内存映射方式打开，TJsonReader<UTF8CHAR> 直接在 UTF-8 字节上逐 Token 解析：
+ * 不复制文件、不整体转换为 UTF-16，只为每个 Token 的键名与值分配字符串；
+ * 每次只在内存中保留一行的 Token（不再同时持有文件字符串、DOM 与结构体三份数据）
+ */
+class FAbilityEditorJsonRowReader : public FAbilityEditorRowSource
+{
+public:
+	FAbilityEditorJsonRowReader();
+	virtual ~FAbilityEditorJsonRowReader() override;
+
+	/** 打开 JSON 文件并校验根节点为数组 */
+	bool OpenFile(const FString& FilePath);
+
+	virtual bool ReadNextRow(FAbilityEditorJsonRow& OutRow) override;
+
+private:
+	/** 将 JsonReader 当前所在的 Token 追加到 OutRow */
+	void AppendCurrentToken(EJsonNotation Notation, FAbilityEditorJsonRow& OutRow) const;
+
+	bool SetError(const FString& InMessage);
+
+	FAbilityEditorMappedFile File;
+	TSharedPtr<TJsonReader<UTF8CHAR>> JsonReader;
+	bool bFinished = false;
+};
+
+/**
+ * 将一行 Token 直接绑定到 RowStruct 内存
+ * 字段匹配与类型转换规则与 FJsonObjectConverter 保持一致：按属性名大小写不敏感匹配，未知字段忽略，类型不匹配则该行失败
+ * 构造时预建全部嵌套结构体的属性索引，BindRow 只读，可在 ParallelFor 中并发调用
+ */
+class FAbilityEditorJsonRowBinder
+{
+public:
+	explicit FAbilityEditorJsonRowBinder(const UScriptStruct* InRowStruct);
+
+	/** 将 Row 的 Token 写入已 InitializeStruct 的 RowData */
+	bool BindRow(const FAbilityEditorJsonRow& Row, void* RowData, FString& OutError) const;
+
+	/** RowStruct 中是否包含硬引用对象属性（绑定时可能触发加载，只能在游戏线程执行） */
+	bool RequiresGameThread() const { return bRequiresGameThread; }
+
+private:
+	void BuildPropertyIndex(const UStruct* Struct);
+
+	bool BindStruct(const UStruct* Struct, void* StructData, const TArray<FAbilityEditorJsonToken>& Tokens, int32& Cursor, FString& OutError) const;
+	bool BindValue(const FProperty* Property, void* ValuePtr, const TArray<FAbilityEditorJsonToken>& Tokens, int32& Cursor, FString& OutError) const;
+	static void SkipValue(const TArray<FAbilityEditorJsonToken>& Tokens, int32& Cursor);
+
+	const UScriptStruct* RowStruct = nullptr;
+
+	/** 结构体 -> (属性名 -> 属性)，FString 键的 TMap 查找大小写不敏感 */
+	TMap<const UStruct*, TMap<FString, const FProperty*>> PropertyIndex;
+
+	bool bRequiresGameThread = false;
+};
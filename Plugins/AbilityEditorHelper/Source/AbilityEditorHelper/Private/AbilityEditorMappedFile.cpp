@@ -0,0 +1,65 @@
+// AbilityEditorMappedFile.cpp
+
+#include "AbilityEditorMappedFile.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+FAbilityEditorMappedFile::FAbilityEditorMappedFile() = default;
+
+FAbilityEditorMappedFile::~FAbilityEditorMappedFile()
+{
+	// 映射区域必须先于文件句柄释放
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+bool FAbilityEditorMappedFile::Open(const FString& FilePath, FString& OutError)
+{
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	LoadedBytes.Empty();
+	Data = nullptr;
+	Size = 0;
+
+	FOpenMappedResult OpenResult = FPlatformFileManager::Get().GetPlatformFile().OpenMappedEx(*FilePath);
+	if (OpenResult.HasValue())
+	{
+		MappedFile = OpenResult.StealValue();
+		const int64 FileSize = MappedFile->GetFileSize();
+		if (FileSize > 0)
+		{
+			MappedRegion.Reset(MappedFile->MapRegion(0, FileSize));
+		}
+	}
+
+	if (MappedRegion.IsValid())
+	{
+		Data = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+		return true;
+	}
+
+	// 不支持映射的平台 / 文件系统，或空文件：整体读入原始字节
+	MappedFile.Reset();
+	if (!FFileHelper::LoadFileToArray(LoadedBytes, *FilePath))
+	{
+		OutError = FString::Printf(TEXT("无法读取文件：%s"), *FilePath);
+		return false;
+	}
+	Data = LoadedBytes.GetData();
+	Size = LoadedBytes.Num();
+	return true;
+}
+
+FUtf8StringView FAbilityEditorMappedFile::GetUtf8Text() const
+{
+	const UTF8CHAR* Text = reinterpret_cast<const UTF8CHAR*>(Data);
+	int64 Length = Size;
+	if (Length >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+	{
+		Text += 3;
+		Length -= 3;
+	}
+	return FUtf8StringView(Text, static_cast<int32>(FMath::Min<int64>(Length, MAX_int32)));
+}
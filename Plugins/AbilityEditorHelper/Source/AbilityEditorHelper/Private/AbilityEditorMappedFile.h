@@ -0,0 +1,42 @@
+// AbilityEditorMappedFile.h
+// 导入数据文件的只读视图（内存映射，不复制、不转码）
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * 以只读方式打开整个文件，直接访问原始字节
+ * - 优先使用 IMappedFileHandle 内存映射：文件内容不复制到进程堆，按需由系统分页读入
+ * - 平台不支持映射（或文件为空）时回退为整体读入一次原始字节，仍不做任何编码转换
+ * 视图在对象销毁前有效
+ */
+class FAbilityEditorMappedFile : public FNoncopyable
+{
+public:
+	FAbilityEditorMappedFile();
+	~FAbilityEditorMappedFile();
+
+	/** 打开文件；失败时 OutError 为错误描述 */
+	bool Open(const FString& FilePath, FString& OutError);
+
+	const uint8* GetData() const { return Data; }
+	int64 GetSize() const { return Size; }
+
+	/** 按 UTF-8 文本访问（跳过 UTF-8 BOM） */
+	FUtf8StringView GetUtf8Text() const;
+
+	/** 是否为内存映射（false 表示使用了整体读入的回退路径） */
+	bool IsMapped() const { return MappedRegion.IsValid(); }
+
+private:
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray64<uint8> LoadedBytes;
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+};
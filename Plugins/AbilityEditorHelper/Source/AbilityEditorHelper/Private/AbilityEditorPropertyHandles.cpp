@@ -0,0 +1,92 @@
+// AbilityEditorPropertyHandles.cpp
+
+#include "AbilityEditorPropertyHandles.h"
+#include "AbilityEditorTypes.h"
+#include "GameplayEffect.h"
+#include "GameplayTagContainer.h"
+#include "Abilities/GameplayAbility.h"
+#include "GameplayEffectComponents/AbilitiesGameplayEffectComponent.h"
+
+namespace
+{
+	FAbilityEditorPropertyHandles GPropertyHandles;
+	bool GPropertyHandlesInitialized = false;
+
+	/** 按名称与期望类型解析属性，失败时记录到 OutMissing */
+	template<typename PropertyType>
+	PropertyType* ResolveProperty(const UStruct* Owner, const TCHAR* PropertyName, TArray<FString>& OutMissing)
+	{
+		PropertyType* Property = CastField<PropertyType>(Owner->FindPropertyByName(PropertyName));
+		if (!Property)
+		{
+			OutMissing.Add(FString::Printf(TEXT("%s::%s（期望 %s）"), *Owner->GetName(), PropertyName, *PropertyType::StaticClass()->GetName()));
+		}
+		return Property;
+	}
+
+	/** 解析 FGameplayTagContainer 类型的属性 */
+	FStructProperty* ResolveTagContainerProperty(const UStruct* Owner, const TCHAR* PropertyName, TArray<FString>& OutMissing)
+	{
+		FStructProperty* Property = CastField<FStructProperty>(Owner->FindPropertyByName(PropertyName));
+		if (!Property || Property->Struct != FGameplayTagContainer::StaticStruct())
+		{
+			OutMissing.Add(FString::Printf(TEXT("%s::%s（期望 FGameplayTagContainer）"), *Owner->GetName(), PropertyName));
+			return nullptr;
+		}
+		return Property;
+	}
+}
+
+const FAbilityEditorPropertyHandles& FAbilityEditorPropertyHandles::Get()
+{
+	if (!GPropertyHandlesInitialized)
+	{
+		Initialize();
+	}
+	return GPropertyHandles;
+}
+
+void FAbilityEditorPropertyHandles::Initialize()
+{
+	TArray<FString> Missing;
+	FAbilityEditorPropertyHandles& Handles = GPropertyHandles;
+
+	const UClass* GEClass = UGameplayEffect::StaticClass();
+	Handles.GEComponents = ResolveProperty<FArrayProperty>(GEClass, TEXT("GEComponents"), Missing);
+
+	Handles.GrantAbilityConfigs = ResolveProperty<FArrayProperty>(UAbilitiesGameplayEffectComponent::StaticClass(), TEXT("GrantAbilityConfigs"), Missing);
+
+	const UClass* GAClass = UGameplayAbility::StaticClass();
+	Handles.CostGameplayEffectClass = ResolveProperty<FClassProperty>(GAClass, TEXT("CostGameplayEffectClass"), Missing);
+	Handles.CooldownGameplayEffectClass = ResolveProperty<FClassProperty>(GAClass, TEXT("CooldownGameplayEffectClass"), Missing);
+
+	Handles.AbilityTags = ResolveTagContainerProperty(GAClass, TEXT("AbilityTags"), Missing);
+	Handles.CancelAbilitiesWithTag = ResolveTagContainerProperty(GAClass, TEXT("CancelAbilitiesWithTag"), Missing);
+	Handles.BlockAbilitiesWithTag = ResolveTagContainerProperty(GAClass, TEXT("BlockAbilitiesWithTag"), Missing);
+	Handles.ActivationOwnedTags = ResolveTagContainerProperty(GAClass, TEXT("ActivationOwnedTags"), Missing);
+	Handles.ActivationRequiredTags = ResolveTagContainerProperty(GAClass, TEXT("ActivationRequiredTags"), Missing);
+	Handles.ActivationBlockedTags = ResolveTagContainerProperty(GAClass, TEXT("ActivationBlockedTags"), Missing);
+	Handles.SourceRequiredTags = ResolveTagContainerProperty(GAClass, TEXT("SourceRequiredTags"), Missing);
+	Handles.SourceBlockedTags = ResolveTagContainerProperty(GAClass, TEXT("SourceBlockedTags"), Missing);
+	Handles.TargetRequiredTags = ResolveTagContainerProperty(GAClass, TEXT("TargetRequiredTags"), Missing);
+	Handles.TargetBlockedTags = ResolveTagContainerProperty(GAClass, TEXT("TargetBlockedTags"), Missing);
+
+	Handles.AbilityTriggers = ResolveProperty<FArrayProperty>(GAClass, TEXT("AbilityTriggers"), Missing);
+
+	Handles.bServerRespectsRemoteAbilityCancellation = ResolveProperty<FBoolProperty>(GAClass, TEXT("bServerRespectsRemoteAbilityCancellation"), Missing);
+	Handles.bReplicateInputDirectly = ResolveProperty<FBoolProperty>(GAClass, TEXT("bReplicateInputDirectly"), Missing);
+	Handles.bRetriggerInstancedAbility = ResolveProperty<FBoolProperty>(GAClass, TEXT("bRetriggerInstancedAbility"), Missing);
+
+	Handles.NetExecutionPolicy = ResolveProperty<FByteProperty>(GAClass, TEXT("NetExecutionPolicy"), Missing);
+	Handles.NetSecurityPolicy = ResolveProperty<FByteProperty>(GAClass, TEXT("NetSecurityPolicy"), Missing);
+	Handles.InstancingPolicy = ResolveProperty<FByteProperty>(GAClass, TEXT("InstancingPolicy"), Missing);
+	Handles.ReplicationPolicy = ResolveProperty<FByteProperty>(GAClass, TEXT("ReplicationPolicy"), Missing);
+
+	GPropertyHandlesInitialized = true;
+
+	if (Missing.Num() > 0)
+	{
+		UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 以下 %d 个属性无法通过反射解析，导入时将跳过对应字段：\n%s"),
+			Missing.Num(), *FString::Join(Missing, TEXT("\n")));
+	}
+}
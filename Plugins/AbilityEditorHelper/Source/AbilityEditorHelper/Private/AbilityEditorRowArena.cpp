@@ -0,0 +1,92 @@
+// AbilityEditorRowArena.cpp
+
+#include "AbilityEditorRowArena.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/Class.h"
+
+FAbilityEditorRowArena::FAbilityEditorRowArena(const UScriptStruct* InRowStruct, int32 InRowsPerBlock)
+	: RowStruct(InRowStruct)
+	, RowsPerBlock(FMath::Max(InRowsPerBlock, 1))
+{
+	check(RowStruct);
+	RowAlignment = FMath::Max(RowStruct->GetMinAlignment(), 1);
+	RowStride = Align(FMath::Max(RowStruct->GetStructureSize(), 1), RowAlignment);
+}
+
+FAbilityEditorRowArena::~FAbilityEditorRowArena()
+{
+	Reset();
+}
+
+FAbilityEditorRowView FAbilityEditorRowArena::Allocate()
+{
+	FAbilityEditorRowView Row;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (FreeSlots.Num() > 0)
+		{
+			Row.Slot = FreeSlots.Pop(EAllowShrinking::No);
+		}
+		else
+		{
+			Row.Slot = NumSlots++;
+			if (Row.Slot / RowsPerBlock >= Blocks.Num())
+			{
+				Blocks.Add(static_cast<uint8*>(FMemory::Malloc(static_cast<SIZE_T>(RowStride) * RowsPerBlock, RowAlignment)));
+			}
+			LiveSlots.Add(false);
+		}
+		LiveSlots[Row.Slot] = true;
+		Row.Data = GetSlotData(Row.Slot);
+	}
+
+	// 初始化在锁外进行，并发绑定时互不阻塞
+	RowStruct->InitializeStruct(Row.Data);
+	return Row;
+}
+
+FAbilityEditorRowView FAbilityEditorRowArena::AllocateCopy(const uint8* Source)
+{
+	FAbilityEditorRowView Row = Allocate();
+	RowStruct->CopyScriptStruct(Row.Data, Source);
+	return Row;
+}
+
+void FAbilityEditorRowArena::Release(FAbilityEditorRowView& Row)
+{
+	if (!Row.IsValid())
+	{
+		return;
+	}
+
+	RowStruct->DestroyStruct(Row.Data);
+	{
+		FScopeLock ScopeLock(&Lock);
+		LiveSlots[Row.Slot] = false;
+		FreeSlots.Add(Row.Slot);
+	}
+	Row = FAbilityEditorRowView();
+}
+
+void FAbilityEditorRowArena::Reset()
+{
+	for (TConstSetBitIterator<> It(LiveSlots); It; ++It)
+	{
+		RowStruct->DestroyStruct(GetSlotData(It.GetIndex()));
+	}
+	for (uint8* Block : Blocks)
+	{
+		FMemory::Free(Block);
+	}
+
+	Blocks.Empty();
+	FreeSlots.Empty();
+	LiveSlots.Empty();
+	NumSlots = 0;
+}
+
+int32 FAbilityEditorRowArena::GetNumLiveRows() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return NumSlots - FreeSlots.Num();
+}
@@ -0,0 +1,72 @@
+// AbilityEditorRowArena.h
+// 导入期间暂存行结构体的竞技场分配器
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * 竞技场中的一行结构体（不拥有内存，只在所属竞技场 Reset / 析构前有效）
+ */
+struct FAbilityEditorRowView
+{
+	uint8* Data = nullptr;
+
+	/** 在竞技场中的槽位 */
+	int32 Slot = INDEX_NONE;
+
+	bool IsValid() const { return Data != nullptr; }
+	uint8* Get() const { return Data; }
+};
+
+/**
+ * 一次导入内暂存行结构体（绑定后的新配置、可取消导入保留的旧行）的竞技场
+ * - 行按块连续存放，分配只是取一个空闲槽位，不再每行一次堆分配加 TSharedPtr 控制块
+ * - Allocate 返回已 InitializeStruct 的行；Release 立即析构并归还槽位供后续行复用（未变化的行用完即还，常驻内存与变化行数量相关）
+ * - Reset / 析构时析构全部仍存活的行（释放其中的 TArray、FString 等）并一次性释放所有块
+ * Allocate / Release 可在 ParallelFor 中并发调用；Reset 不可与其并发
+ */
+class FAbilityEditorRowArena : public FNoncopyable
+{
+public:
+	explicit FAbilityEditorRowArena(const UScriptStruct* InRowStruct, int32 InRowsPerBlock = 256);
+	~FAbilityEditorRowArena();
+
+	/** 分配一行并初始化为结构体默认值 */
+	FAbilityEditorRowView Allocate();
+
+	/** 分配一行并复制 Source 的内容 */
+	FAbilityEditorRowView AllocateCopy(const uint8* Source);
+
+	/** 析构该行并归还槽位，Row 随后被置空；传入空行时什么也不做 */
+	void Release(FAbilityEditorRowView& Row);
+
+	/** 析构全部存活的行并释放所有块 */
+	void Reset();
+
+	const UScriptStruct* GetRowStruct() const { return RowStruct; }
+
+	/** 当前存活的行数 */
+	int32 GetNumLiveRows() const;
+
+private:
+	uint8* GetSlotData(int32 Slot) const
+	{
+		return Blocks[Slot / RowsPerBlock] + static_cast<SIZE_T>(Slot % RowsPerBlock) * RowStride;
+	}
+
+	const UScriptStruct* RowStruct = nullptr;
+	int32 RowStride = 0;
+	int32 RowAlignment = 0;
+	int32 RowsPerBlock = 0;
+
+	TArray<uint8*> Blocks;
+	/** 已从块中切出的槽位数 */
+	int32 NumSlots = 0;
+	TArray<int32> FreeSlots;
+	/** 槽位 -> 是否存活（Reset 时只析构存活的行） */
+	TBitArray<> LiveSlots;
+
+	mutable FCriticalSection Lock;
+};
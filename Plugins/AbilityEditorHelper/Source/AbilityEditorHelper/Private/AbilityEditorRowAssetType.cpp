@@ -0,0 +1,80 @@
+// AbilityEditorRowAssetType.cpp
+
+#include "AbilityEditorRowAssetType.h"
+#include "AbilityEditorHelperLibrary.h"
+#include "AbilityEditorTypes.h"
+
+namespace
+{
+	/** 已注册的行类型（按注册顺序；替换同名类型时保持原位置） */
+	TArray<TSharedRef<const FAbilityEditorRowAssetType>>& GetRegisteredTypes()
+	{
+		static TArray<TSharedRef<const FAbilityEditorRowAssetType>> Types;
+		return Types;
+	}
+
+	int32 FindTypeIndex(FName Name)
+	{
+		return GetRegisteredTypes().IndexOfByPredicate([Name](const TSharedRef<const FAbilityEditorRowAssetType>& Type)
+		{
+			return Type->Name == Name;
+		});
+	}
+}
+
+bool FAbilityEditorRowAssetTypeRegistry::Register(const FAbilityEditorRowAssetType& Type)
+{
+	check(IsInGameThread());
+	if (!Type.IsValid())
+	{
+		UE_LOG(LogAbilityEditor, Error, TEXT("[AbilityEditorHelper] 行类型 %s 注册失败：Name、RowStruct、AssetPrefix、AssetClassPath、ResolveTable、ApplyRow 均为必填"), *Type.Name.ToString());
+		return false;
+	}
+
+	const TSharedRef<const FAbilityEditorRowAssetType> SharedType = MakeShared<FAbilityEditorRowAssetType>(Type);
+	const int32 ExistingIndex = FindTypeIndex(Type.Name);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		GetRegisteredTypes()[ExistingIndex] = SharedType;
+	}
+	else
+	{
+		GetRegisteredTypes().Add(SharedType);
+	}
+	UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 已注册行类型 %s（%s -> %s）"), *Type.Name.ToString(), *Type.RowStruct->GetName(), *Type.AssetClassPath.ToString());
+	return true;
+}
+
+void FAbilityEditorRowAssetTypeRegistry::Unregister(FName Name)
+{
+	check(IsInGameThread());
+	const int32 Index = FindTypeIndex(Name);
+	if (Index != INDEX_NONE)
+	{
+		GetRegisteredTypes().RemoveAt(Index);
+	}
+}
+
+TSharedPtr<const FAbilityEditorRowAssetType> FAbilityEditorRowAssetTypeRegistry::Find(FName Name)
+{
+	check(IsInGameThread());
+	const int32 Index = FindTypeIndex(Name);
+	if (Index == INDEX_NONE)
+	{
+		return nullptr;
+	}
+	return GetRegisteredTypes()[Index];
+}
+
+TArray<TSharedRef<const FAbilityEditorRowAssetType>> FAbilityEditorRowAssetTypeRegistry::GetAll()
+{
+	check(IsInGameThread());
+	return GetRegisteredTypes();
+}
+
+FName FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName(EAbilityEditorGenerationTarget Target)
+{
+	static const FName GameplayEffectName(TEXT("GameplayEffect"));
+	static const FName GameplayAbilityName(TEXT("GameplayAbility"));
+	return Target == EAbilityEditorGenerationTarget::GameplayAbility ? GameplayAbilityName : GameplayEffectName;
+}
@@ -0,0 +1,38 @@
+// AbilityEditorRowShard.cpp
+
+#include "AbilityEditorRowShard.h"
+#include "Misc/Crc.h"
+
+namespace
+{
+	FAbilityEditorRowShard GCurrentRowShard;
+}
+
+int32 FAbilityEditorRowShard::GetShardIndex(FName RowName, int32 ShardCount)
+{
+	if (ShardCount <= 1)
+	{
+		return 0;
+	}
+
+	// CRC32 的结果只取决于字符串内容，协调进程与各工作进程的划分一致
+	const FString Key = RowName.ToString().ToLower();
+	return static_cast<int32>(FCrc::StrCrc32(*Key) % static_cast<uint32>(ShardCount));
+}
+
+const FAbilityEditorRowShard& FAbilityEditorRowShard::GetCurrent()
+{
+	return GCurrentRowShard;
+}
+
+bool FAbilityEditorRowShard::SetCurrent(int32 ShardCount, int32 ShardIndex)
+{
+	if (ShardCount < 1 || ShardIndex < 0 || ShardIndex >= ShardCount)
+	{
+		return false;
+	}
+
+	GCurrentRowShard.Count = ShardCount;
+	GCurrentRowShard.Index = ShardIndex;
+	return true;
+}
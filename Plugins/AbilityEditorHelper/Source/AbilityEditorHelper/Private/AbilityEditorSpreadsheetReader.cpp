@@ -0,0 +1,1565 @@
+// AbilityEditorSpreadsheetReader.cpp
+
+#include "AbilityEditorSpreadsheetReader.h"
+#include "AbilityEditorTypes.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+
+#if WITH_EDITOR
+#include "FileUtilities/ZipArchiveReader.h"
+#endif
+
+namespace
+{
+	/** Excel 工作表名的最大长度（Python 工具生成与查找子表时按此截断） */
+	constexpr int32 MaxSheetNameLength = 31;
+
+	FString TruncateSheetName(const FString& Name)
+	{
+		return Name.Len() <= MaxSheetNameLength ? Name : Name.Left(MaxSheetNameLength);
+	}
+
+	// ===================== 字段规则（与 Schema 导出的 kind 一致） =====================
+
+	enum class EFieldKind : uint8
+	{
+		Bool,
+		Int,
+		Float,
+		String,
+		Enum,
+		Struct,
+		Array,
+		Unknown,
+	};
+
+	EFieldKind GetFieldKind(const FProperty* Property)
+	{
+		if (CastField<FBoolProperty>(Property)) return EFieldKind::Bool;
+		if (CastField<FIntProperty>(Property) || CastField<FInt64Property>(Property) || CastField<FUInt32Property>(Property) || CastField<FUInt64Property>(Property)) return EFieldKind::Int;
+		if (CastField<FFloatProperty>(Property) || CastField<FDoubleProperty>(Property)) return EFieldKind::Float;
+		if (CastField<FStrProperty>(Property) || CastField<FNameProperty>(Property) || CastField<FTextProperty>(Property)) return EFieldKind::String;
+		if (CastField<FEnumProperty>(Property)) return EFieldKind::Enum;
+		if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+		{
+			return ByteProperty->Enum ? EFieldKind::Enum : EFieldKind::Int;
+		}
+		if (CastField<FStructProperty>(Property)) return EFieldKind::Struct;
+		if (CastField<FArrayProperty>(Property)) return EFieldKind::Array;
+		return EFieldKind::Unknown;
+	}
+
+	/** 基本类型数组：主表中一个单元格，逗号/分号分隔 */
+	bool IsPrimitiveArray(const FProperty* Property)
+	{
+		const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+		return ArrayProperty && GetFieldKind(ArrayProperty->Inner) != EFieldKind::Struct;
+	}
+
+	/** 表头中的列名：ExcelName 元数据，缺省为字段名 */
+	FString GetColumnName(const FProperty* Property)
+	{
+		const FString ExcelName = Property->GetMetaData(TEXT("ExcelName")).TrimStartAndEnd();
+		return ExcelName.IsEmpty() ? Property->GetName() : ExcelName;
+	}
+
+	// ===================== 单元格取值（对应 Python 工具的 _safe_str / _safe_bool / _safe_num） =====================
+
+	using ECellType = FAbilityEditorSheetCell::EType;
+
+	bool IsNone(const FAbilityEditorSheetCell* Cell)
+	{
+		return !Cell || Cell->Type == ECellType::Empty;
+	}
+
+	/** 数字文本是否为浮点数（与 openpyxl 的判断一致） */
+	bool IsFloatNumberText(const FString& Text)
+	{
+		int32 Index;
+		return Text.FindChar(TEXT('.'), Index) || Text.FindChar(TEXT('e'), Index) || Text.FindChar(TEXT('E'), Index);
+	}
+
+	FString SafeStr(const FAbilityEditorSheetCell* Cell)
+	{
+		if (IsNone(Cell))
+		{
+			return FString();
+		}
+		switch (Cell->Type)
+		{
+		case ECellType::Boolean:
+			return Cell->Text == TEXT("1") ? TEXT("True") : TEXT("False");
+		case ECellType::Number:
+			return IsFloatNumberText(Cell->Text) ? FAbilityEditorJsonTokenWriter::FormatFloat(FCString::Atod(*Cell->Text)) : Cell->Text;
+		default:
+			return Cell->Text.TrimStartAndEnd();
+		}
+	}
+
+	bool ParseBoolText(const FString& Text, bool bDefault)
+	{
+		const FString Lower = Text.TrimStartAndEnd().ToLower();
+		if (Lower == TEXT("1") || Lower == TEXT("true") || Lower == TEXT("yes") || Lower == TEXT("y") || Lower == TEXT("t") || Lower == TEXT("on"))
+		{
+			return true;
+		}
+		if (Lower == TEXT("0") || Lower == TEXT("false") || Lower == TEXT("no") || Lower == TEXT("n") || Lower == TEXT("f") || Lower == TEXT("off"))
+		{
+			return false;
+		}
+		return bDefault;
+	}
+
+	bool SafeBool(const FAbilityEditorSheetCell* Cell, bool bDefault)
+	{
+		if (IsNone(Cell) || (Cell->Type == ECellType::String && Cell->Text.IsEmpty()))
+		{
+			return bDefault;
+		}
+		if (Cell->Type == ECellType::Boolean)
+		{
+			return Cell->Text == TEXT("1");
+		}
+		return ParseBoolText(SafeStr(Cell), bDefault);
+	}
+
+	/** 单元格数值：整数与浮点数分别保留，写出的 JSON 数字与 Python 工具一致 */
+	struct FCellNumber
+	{
+		bool bInteger = true;
+		int64 Int = 0;
+		double Float = 0.0;
+
+		double AsDouble() const { return bInteger ? static_cast<double>(Int) : Float; }
+	};
+
+	FCellNumber MakeInteger(int64 Value)
+	{
+		FCellNumber Number;
+		Number.Int = Value;
+		return Number;
+	}
+
+	FCellNumber MakeFloat(double Value)
+	{
+		FCellNumber Number;
+		Number.bInteger = false;
+		Number.Float = Value;
+		return Number;
+	}
+
+	/** 文本中含小数点按浮点数解析，否则按整数解析；无法解析时为 0 */
+	FCellNumber ParseNumberText(const FString& InText)
+	{
+		const FString Text = InText.TrimStartAndEnd();
+		int32 Index;
+		if (Text.FindChar(TEXT('.'), Index))
+		{
+			double Value = 0.0;
+			return LexTryParseString(Value, *Text) ? MakeFloat(Value) : MakeInteger(0);
+		}
+		int64 Value = 0;
+		return LexTryParseString(Value, *Text) ? MakeInteger(Value) : MakeInteger(0);
+	}
+
+	FCellNumber SafeNum(const FAbilityEditorSheetCell* Cell)
+	{
+		if (IsNone(Cell) || (Cell->Type == ECellType::String && Cell->Text.IsEmpty()))
+		{
+			return MakeInteger(0);
+		}
+		switch (Cell->Type)
+		{
+		case ECellType::Boolean:
+			return MakeInteger(Cell->Text == TEXT("1") ? 1 : 0);
+		case ECellType::Number:
+			if (IsFloatNumberText(Cell->Text))
+			{
+				return MakeFloat(FCString::Atod(*Cell->Text));
+			}
+			else
+			{
+				int64 Value = 0;
+				return LexTryParseString(Value, *Cell->Text) ? MakeInteger(Value) : MakeFloat(FCString::Atod(*Cell->Text));
+			}
+		default:
+			return ParseNumberText(Cell->Text);
+		}
+	}
+
+	/** 逗号/分号分隔的列表：去空白、去空项 */
+	TArray<FString> SplitList(const FString& Text)
+	{
+		TArray<FString> Items;
+		Text.Replace(TEXT(";"), TEXT(",")).ParseIntoArray(Items, TEXT(","), false);
+		for (FString& Item : Items)
+		{
+			Item.TrimStartAndEndInline();
+		}
+		Items.RemoveAll([](const FString& Item) { return Item.IsEmpty(); });
+		return Items;
+	}
+
+	/** Tag 列表：分隔规则同 SplitList，并去重保持顺序 */
+	TArray<FString> SplitTags(const FString& Text)
+	{
+		TArray<FString> Tags;
+		for (FString& Tag : SplitList(Text))
+		{
+			if (!Tags.ContainsByPredicate([&Tag](const FString& Existing) { return Existing.Equals(Tag, ESearchCase::CaseSensitive); }))
+			{
+				Tags.Add(MoveTemp(Tag));
+			}
+		}
+		return Tags;
+	}
+
+	/** 单元格中的 Tag 列表（空值、false 与数字 0 均视为空） */
+	TArray<FString> SplitTagCell(const FAbilityEditorSheetCell* Cell)
+	{
+		if (IsNone(Cell) || Cell->Text.IsEmpty())
+		{
+			return TArray<FString>();
+		}
+		if (Cell->Type == ECellType::Boolean && Cell->Text != TEXT("1"))
+		{
+			return TArray<FString>();
+		}
+		if (Cell->Type == ECellType::Number && FCString::Atod(*Cell->Text) == 0.0)
+		{
+			return TArray<FString>();
+		}
+		return SplitTags(Cell->Type == ECellType::String ? Cell->Text : SafeStr(Cell));
+	}
+
+	void WriteNumber(FAbilityEditorJsonTokenWriter& Writer, const FString& Key, const FCellNumber& Value)
+	{
+		if (Value.bInteger)
+		{
+			Writer.Integer(Key, Value.Int);
+		}
+		else
+		{
+			Writer.Float(Key, Value.Float);
+		}
+	}
+
+	// ===================== 特殊结构体的单元格写法 =====================
+
+	/** 格式："Require:Tag.A,Tag.B|Ignore:Tag.C"；没有前缀时整体视为 RequireTags */
+	void WriteTagRequirements(FAbilityEditorJsonTokenWriter& Writer, const FString& Key, const FString& Text)
+	{
+		TArray<FString> Require;
+		TArray<FString> Ignore;
+		if (!Text.IsEmpty())
+		{
+			int32 BarIndex;
+			if (Text.FindChar(TEXT('|'), BarIndex))
+			{
+				TArray<FString> Parts;
+				Text.ParseIntoArray(Parts, TEXT("|"), false);
+				for (FString& Part : Parts)
+				{
+					Part.TrimStartAndEndInline();
+					if (Part.StartsWith(TEXT("Require:"), ESearchCase::CaseSensitive))
+					{
+						Require = SplitTags(Part.Mid(8));
+					}
+					else if (Part.StartsWith(TEXT("Ignore:"), ESearchCase::CaseSensitive))
+					{
+						Ignore = SplitTags(Part.Mid(7));
+					}
+				}
+			}
+			else if (Text.StartsWith(TEXT("Require:"), ESearchCase::CaseSensitive))
+			{
+				Require = SplitTags(Text.Mid(8));
+			}
+			else if (Text.StartsWith(TEXT("Ignore:"), ESearchCase::CaseSensitive))
+			{
+				Ignore = SplitTags(Text.Mid(7));
+			}
+			else
+			{
+				Require = SplitTags(Text);
+			}
+		}
+
+		Writer.BeginObject(Key);
+		Writer.TagContainer(TEXT("RequireTags"), Require);
+		Writer.TagContainer(TEXT("IgnoreTags"), Ignore);
+		Writer.EndObject();
+	}
+
+	/** 格式：/Script/Module.Class:Property */
+	void WriteAttribute(FAbilityEditorJsonTokenWriter& Writer, const FString& Key, const FString& Text)
+	{
+		if (Text.IsEmpty())
+		{
+			Writer.EmptyObject(Key);
+			return;
+		}
+
+		FString ClassPath;
+		FString PropertyName;
+		if (!Text.Split(TEXT(":"), &ClassPath, &PropertyName))
+		{
+			// Python 工具在此中止整个导出；这里原样写入，由绑定阶段报告该行失败并跳过
+			Writer.String(Key, Text);
+			return;
+		}
+		ClassPath.TrimStartAndEndInline();
+		PropertyName.TrimStartAndEndInline();
+
+		Writer.BeginObject(Key);
+		Writer.String(TEXT("AttributeName"), PropertyName);
+		Writer.String(TEXT("Attribute"), ClassPath + TEXT(":") + PropertyName);
+		Writer.String(TEXT("AttributeOwner"), FString::Printf(TEXT("/Script/CoreUObject.Class'%s'"), *ClassPath));
+		Writer.EndObject();
+	}
+
+	void WriteDefaultAttributeBasedConfig(FAbilityEditorJsonTokenWriter& Writer, const FString& Key)
+	{
+		Writer.BeginObject(Key);
+		Writer.String(TEXT("BackingAttribute"), FString());
+		Writer.String(TEXT("AttributeCalculationType"), TEXT("AttributeMagnitude"));
+		Writer.Float(TEXT("Coefficient"), 1.0);
+		Writer.Float(TEXT("PreMultiplyAdditiveValue"), 0.0);
+		Writer.Float(TEXT("PostMultiplyAdditiveValue"), 0.0);
+		Writer.EndObject();
+	}
+
+	void WriteDefaultSetByCallerConfig(FAbilityEditorJsonTokenWriter& Writer, const FString& Key)
+	{
+		Writer.BeginObject(Key);
+		Writer.BeginObject(TEXT("DataTag"));
+		Writer.String(TEXT("TagName"), FString());
+		Writer.EndObject();
+		Writer.String(TEXT("DataName"), FString());
+		Writer.EndObject();
+	}
+
+	void WriteStructCell(FAbilityEditorJsonTokenWriter& Writer, const FString& Key, const UScriptStruct* Struct, const FAbilityEditorSheetCell* Cell)
+	{
+		const FString StructName = Struct ? Struct->GetName() : FString();
+		if (StructName == TEXT("GameplayTagContainer"))
+		{
+			Writer.TagContainer(Key, SplitTagCell(Cell));
+			return;
+		}
+
+		const FString Text = SafeStr(Cell);
+		if (StructName == TEXT("GameplayAttribute"))
+		{
+			WriteAttribute(Writer, Key, Text);
+			return;
+		}
+		if (StructName == TEXT("TagRequirementsConfig"))
+		{
+			WriteTagRequirements(Writer, Key, Text);
+			return;
+		}
+		if (StructName == TEXT("GameplayTag"))
+		{
+			Writer.BeginObject(Key);
+			Writer.String(TEXT("TagName"), Text);
+			Writer.EndObject();
+			return;
+		}
+
+		// 其余结构体允许在单元格中直接填写 JSON 对象
+		const bool bJsonObject = Text.StartsWith(TEXT("{")) && Text.EndsWith(TEXT("}"));
+		if (bJsonObject && Writer.JsonObject(Key, Text))
+		{
+			return;
+		}
+		if (StructName == TEXT("AttributeBasedModifierConfig"))
+		{
+			WriteDefaultAttributeBasedConfig(Writer, Key);
+		}
+		else if (StructName == TEXT("SetByCallerModifierConfig"))
+		{
+			WriteDefaultSetByCallerConfig(Writer, Key);
+		}
+		else
+		{
+			Writer.EmptyObject(Key);
+		}
+	}
+
+	/** 未归类的属性：按单元格原值写入 */
+	void WriteRawCell(FAbilityEditorJsonTokenWriter& Writer, const FString& Key, const FAbilityEditorSheetCell* Cell)
+	{
+		if (IsNone(Cell))
+		{
+			Writer.Null(Key);
+			return;
+		}
+		switch (Cell->Type)
+		{
+		case ECellType::Boolean:
+			Writer.Boolean(Key, Cell->Text == TEXT("1"));
+			break;
+		case ECellType::Number:
+			WriteNumber(Writer, Key, SafeNum(Cell));
+			break;
+		default:
+			Writer.String(Key, Cell->Text);
+			break;
+		}
+	}
+
+	void WriteScalar(FAbilityEditorJsonTokenWriter& Writer, const FString& Key, const FProperty* Property, const FAbilityEditorSheetCell* Cell)
+	{
+		switch (GetFieldKind(Property))
+		{
+		case EFieldKind::Bool:
+			Writer.Boolean(Key, SafeBool(Cell, false));
+			break;
+		case EFieldKind::Int:
+			WriteNumber(Writer, Key, SafeNum(Cell));
+			break;
+		case EFieldKind::Float:
+			Writer.Float(Key, SafeNum(Cell).AsDouble());
+			break;
+		case EFieldKind::String:
+		case EFieldKind::Enum:
+			Writer.String(Key, SafeStr(Cell));
+			break;
+		case EFieldKind::Struct:
+			WriteStructCell(Writer, Key, CastFieldChecked<FStructProperty>(Property)->Struct, Cell);
+			break;
+		default:
+			WriteRawCell(Writer, Key, Cell);
+			break;
+		}
+	}
+
+	void WritePrimitiveArray(FAbilityEditorJsonTokenWriter& Writer, const FString& Key, const FArrayProperty* ArrayProperty, const FAbilityEditorSheetCell* Cell)
+	{
+		const EFieldKind InnerKind = GetFieldKind(ArrayProperty->Inner);
+
+		Writer.BeginArray(Key);
+		for (const FString& Item : SplitList(SafeStr(Cell)))
+		{
+			switch (InnerKind)
+			{
+			case EFieldKind::Bool:
+				Writer.Boolean(FString(), ParseBoolText(Item, false));
+				break;
+			case EFieldKind::Int:
+				Writer.Integer(FString(), static_cast<int64>(ParseNumberText(Item).AsDouble()));
+				break;
+			case EFieldKind::Float:
+				Writer.Float(FString(), ParseNumberText(Item).AsDouble());
+				break;
+			default:
+				Writer.String(FString(), Item);
+				break;
+			}
+		}
+		Writer.EndArray();
+	}
+
+	// ===================== XML 扫描（xlsx 各部件） =====================
+
+	/**
+	 * 顺序扫描 UTF-8 XML 的最小解析器：只识别开始/结束标签与其后的文本，
+	 * 足以读取 xlsx 的工作表、共享字符串、工作簿与关系部件；不构建 DOM，不校验结构
+	 */
+	class FXmlScanner
+	{
+	public:
+		struct FTag
+		{
+			/** 去掉命名空间前缀的标签名 */
+			FAnsiStringView Name;
+			/** 标签名之后的原始属性文本 */
+			FAnsiStringView Attributes;
+			/** </Name> */
+			bool bEnd = false;
+			/** <Name/> */
+			bool bEmpty = false;
+		};
+
+		explicit FXmlScanner(const TArray<uint8>& InData)
+			: Data(reinterpret_cast<const ANSICHAR*>(InData.GetData()))
+			, Num(InData.Num())
+		{
+		}
+
+		/** 前进到下一个标签（跳过声明、注释、CDATA 与 DOCTYPE） */
+		bool NextTag(FTag& OutTag)
+		{
+			while (true)
+			{
+				const int32 Open = Find('<', Pos);
+				if (Open == INDEX_NONE || Open + 1 >= Num)
+				{
+					Pos = Num;
+					return false;
+				}
+				Pos = Open + 1;
+
+				if (Data[Pos] == '?')
+				{
+					if (!SkipPast("?>"))
+					{
+						return false;
+					}
+					continue;
+				}
+				if (Data[Pos] == '!')
+				{
+					const ANSICHAR* Terminator = StartsWithAt(Pos, "!--") ? "-->" : (StartsWithAt(Pos, "![CDATA[") ? "]]>" : ">");
+					if (!SkipPast(Terminator))
+					{
+						return false;
+					}
+					continue;
+				}
+
+				OutTag.bEnd = Data[Pos] == '/';
+				if (OutTag.bEnd)
+				{
+					++Pos;
+				}
+
+				const int32 NameStart = Pos;
+				while (Pos < Num && !IsNameEnd(Data[Pos]))
+				{
+					++Pos;
+				}
+				OutTag.Name = LocalName(FAnsiStringView(Data + NameStart, Pos - NameStart));
+
+				// 找到标签末尾的 '>'（跳过属性值中的 '>'）
+				const int32 AttributesStart = Pos;
+				ANSICHAR Quote = 0;
+				while (Pos < Num && (Quote != 0 || Data[Pos] != '>'))
+				{
+					if (Quote != 0)
+					{
+						Quote = Data[Pos] == Quote ? 0 : Quote;
+					}
+					else if (Data[Pos] == '"' || Data[Pos] == '\'')
+					{
+						Quote = Data[Pos];
+					}
+					++Pos;
+				}
+				if (Pos >= Num)
+				{
+					return false;
+				}
+
+				int32 AttributesEnd = Pos;
+				OutTag.bEmpty = AttributesEnd > AttributesStart && Data[AttributesEnd - 1] == '/';
+				if (OutTag.bEmpty)
+				{
+					--AttributesEnd;
+				}
+				OutTag.Attributes = FAnsiStringView(Data + AttributesStart, AttributesEnd - AttributesStart);
+				++Pos;
+				return true;
+			}
+		}
+
+		/** 读取当前位置到下一个标签之间的原始文本 */
+		FAnsiStringView ReadText()
+		{
+			const int32 Start = Pos;
+			const int32 End = Find('<', Pos);
+			Pos = End == INDEX_NONE ? Num : End;
+			return FAnsiStringView(Data + Start, Pos - Start);
+		}
+
+		/** 按本地名查找属性值（原始文本，未解码实体） */
+		static FAnsiStringView FindAttribute(FAnsiStringView Attributes, const ANSICHAR* Name)
+		{
+			const int32 Len = Attributes.Len();
+			int32 Index = 0;
+			while (Index < Len)
+			{
+				while (Index < Len && FCharAnsi::IsWhitespace(Attributes[Index]))
+				{
+					++Index;
+				}
+				const int32 NameStart = Index;
+				while (Index < Len && Attributes[Index] != '=' && !FCharAnsi::IsWhitespace(Attributes[Index]))
+				{
+					++Index;
+				}
+				if (Index == NameStart)
+				{
+					break;
+				}
+				const FAnsiStringView AttributeName = LocalName(Attributes.Mid(NameStart, Index - NameStart));
+
+				while (Index < Len && (Attributes[Index] == '=' || FCharAnsi::IsWhitespace(Attributes[Index])))
+				{
+					++Index;
+				}
+				if (Index >= Len || (Attributes[Index] != '"' && Attributes[Index] != '\''))
+				{
+					break;
+				}
+				const ANSICHAR Quote = Attributes[Index++];
+				const int32 ValueStart = Index;
+				while (Index < Len && Attributes[Index] != Quote)
+				{
+					++Index;
+				}
+				const FAnsiStringView Value = Attributes.Mid(ValueStart, Index - ValueStart);
+				++Index;
+
+				if (AttributeName.Equals(Name))
+				{
+					return Value;
+				}
+			}
+			return FAnsiStringView();
+		}
+
+	private:
+		static FAnsiStringView LocalName(FAnsiStringView QualifiedName)
+		{
+			int32 ColonIndex;
+			return QualifiedName.FindChar(':', ColonIndex) ? QualifiedName.RightChop(ColonIndex + 1) : QualifiedName;
+		}
+
+		static bool IsNameEnd(ANSICHAR Char)
+		{
+			return Char == '>' || Char == '/' || FCharAnsi::IsWhitespace(Char);
+		}
+
+		int32 Find(ANSICHAR Char, int32 From) const
+		{
+			for (int32 Index = From; Index < Num; ++Index)
+			{
+				if (Data[Index] == Char)
+				{
+					return Index;
+				}
+			}
+			return INDEX_NONE;
+		}
+
+		bool StartsWithAt(int32 At, const ANSICHAR* Literal) const
+		{
+			for (int32 Offset = 0; Literal[Offset] != '\0'; ++Offset)
+			{
+				if (At + Offset >= Num || Data[At + Offset] != Literal[Offset])
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool SkipPast(const ANSICHAR* Terminator)
+		{
+			const int32 TerminatorLen = FCStringAnsi::Strlen(Terminator);
+			for (; Pos + TerminatorLen <= Num; ++Pos)
+			{
+				if (StartsWithAt(Pos, Terminator))
+				{
+					Pos += TerminatorLen;
+					return true;
+				}
+			}
+			Pos = Num;
+			return false;
+		}
+
+		const ANSICHAR* Data = nullptr;
+		int32 Num = 0;
+		int32 Pos = 0;
+	};
+
+	void AppendCodePoint(FString& Out, uint32 CodePoint)
+	{
+		if constexpr (sizeof(TCHAR) == 2)
+		{
+			if (CodePoint > 0xFFFF)
+			{
+				CodePoint -= 0x10000;
+				Out.AppendChar(static_cast<TCHAR>(0xD800 + (CodePoint >> 10)));
+				Out.AppendChar(static_cast<TCHAR>(0xDC00 + (CodePoint & 0x3FF)));
+				return;
+			}
+		}
+		Out.AppendChar(static_cast<TCHAR>(CodePoint));
+	}
+
+	/** UTF-8 解码、换行规范化（\r\n、\r -> \n）并解码字符实体 */
+	FString DecodeXmlText(FAnsiStringView Raw)
+	{
+		const auto Converted = StringCast<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Raw.GetData()), Raw.Len());
+		FString Text(Converted.Length(), Converted.Get());
+
+		int32 Index;
+		if (Text.FindChar(TEXT('\r'), Index))
+		{
+			Text.ReplaceInline(TEXT("\r\n"), TEXT("\n"), ESearchCase::CaseSensitive);
+			Text.ReplaceInline(TEXT("\r"), TEXT("\n"), ESearchCase::CaseSensitive);
+		}
+		if (!Text.FindChar(TEXT('&'), Index))
+		{
+			return Text;
+		}
+
+		FString Out;
+		Out.Reserve(Text.Len());
+		for (int32 CharIndex = 0; CharIndex < Text.Len(); ++CharIndex)
+		{
+			const int32 Semicolon = Text[CharIndex] == TEXT('&')
+				? Text.Find(TEXT(";"), ESearchCase::CaseSensitive, ESearchDir::FromStart, CharIndex)
+				: INDEX_NONE;
+			if (Semicolon == INDEX_NONE)
+			{
+				Out.AppendChar(Text[CharIndex]);
+				continue;
+			}
+
+			const FString Entity = Text.Mid(CharIndex + 1, Semicolon - CharIndex - 1);
+			uint32 CodePoint = 0;
+			if (Entity.Equals(TEXT("lt"), ESearchCase::CaseSensitive)) CodePoint = '<';
+			else if (Entity.Equals(TEXT("gt"), ESearchCase::CaseSensitive)) CodePoint = '>';
+			else if (Entity.Equals(TEXT("amp"), ESearchCase::CaseSensitive)) CodePoint = '&';
+			else if (Entity.Equals(TEXT("quot"), ESearchCase::CaseSensitive)) CodePoint = '"';
+			else if (Entity.Equals(TEXT("apos"), ESearchCase::CaseSensitive)) CodePoint = '\'';
+			else if (Entity.StartsWith(TEXT("#x"), ESearchCase::CaseSensitive)) CodePoint = FParse::HexNumber(*Entity.Mid(2));
+			else if (Entity.StartsWith(TEXT("#"), ESearchCase::CaseSensitive)) CodePoint = static_cast<uint32>(FCString::Atoi(*Entity.Mid(1)));
+
+			if (CodePoint == 0)
+			{
+				Out.AppendChar(Text[CharIndex]);
+				continue;
+			}
+			AppendCodePoint(Out, CodePoint);
+			CharIndex = Semicolon;
+		}
+		return Out;
+	}
+
+	int32 ParseDecimal(FAnsiStringView Text)
+	{
+		int32 Value = 0;
+		for (const ANSICHAR Char : Text)
+		{
+			if (Char < '0' || Char > '9')
+			{
+				break;
+			}
+			Value = Value * 10 + (Char - '0');
+		}
+		return Value;
+	}
+
+	/** 单元格引用（如 AB12）中的列索引，从 0 开始；没有列字母时返回 INDEX_NONE */
+	int32 ParseColumnIndex(FAnsiStringView CellReference)
+	{
+		int32 Column = 0;
+		for (const ANSICHAR Char : CellReference)
+		{
+			if (!FCharAnsi::IsAlpha(Char))
+			{
+				break;
+			}
+			Column = Column * 26 + (FCharAnsi::ToUpper(Char) - 'A' + 1);
+		}
+		return Column - 1;
+	}
+
+	/** 共享字符串表：富文本各段拼接，忽略注音（rPh） */
+	void ParseSharedStrings(const TArray<uint8>& Xml, TArray<FString>& OutStrings)
+	{
+		FXmlScanner Scanner(Xml);
+		FXmlScanner::FTag Tag;
+		FString Current;
+		bool bInItem = false;
+		bool bInPhonetic = false;
+
+		while (Scanner.NextTag(Tag))
+		{
+			if (Tag.Name.Equals("si"))
+			{
+				if (Tag.bEmpty)
+				{
+					OutStrings.AddDefaulted();
+				}
+				else if (Tag.bEnd)
+				{
+					OutStrings.Add(Current);
+					bInItem = false;
+				}
+				else
+				{
+					Current.Reset();
+					bInItem = true;
+				}
+			}
+			else if (Tag.Name.Equals("rPh") && !Tag.bEmpty)
+			{
+				bInPhonetic = !Tag.bEnd;
+			}
+			else if (Tag.Name.Equals("t") && bInItem && !bInPhonetic && !Tag.bEnd && !Tag.bEmpty)
+			{
+				Current += DecodeXmlText(Scanner.ReadText());
+			}
+		}
+	}
+
+	/** 表头、提示行与空行的处理，工作表与 CSV 共用 */
+	struct FRawSheetRow
+	{
+		/** 行号（xlsx 中从 1 开始；CSV 中为行序号） */
+		int32 RowNumber = 0;
+		/** (列索引, 单元格)，按列升序 */
+		TArray<TPair<int32, FAbilityEditorSheetCell>> Cells;
+
+		const FAbilityEditorSheetCell* FindColumn(int32 Column) const
+		{
+			for (const TPair<int32, FAbilityEditorSheetCell>& Cell : Cells)
+			{
+				if (Cell.Key == Column)
+				{
+					return &Cell.Value;
+				}
+			}
+			return nullptr;
+		}
+
+		bool IsBlank() const
+		{
+			for (const TPair<int32, FAbilityEditorSheetCell>& Cell : Cells)
+			{
+				if (!SafeStr(&Cell.Value).IsEmpty())
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+	/**
+	 * 按 Python 工具的规则生成工作表：
+	 * - 第一行为表头（去空白；重名时后出现的列生效）
+	 * - bDetectHintRow 为 true 时，紧随表头的一行首列为空才视为提示行跳过；为 false 时总是跳过第二行（CSV）
+	 * - 整行为空的行跳过
+	 */
+	void BuildSheet(TArray<FRawSheetRow>& RawRows, int32 MinColumn, bool bDetectHintRow, FAbilityEditorSheet& OutSheet)
+	{
+		if (RawRows.Num() == 0)
+		{
+			return;
+		}
+
+		const FRawSheetRow& HeaderRow = RawRows[0];
+		for (const TPair<int32, FAbilityEditorSheetCell>& Cell : HeaderRow.Cells)
+		{
+			const FString Header = SafeStr(&Cell.Value);
+			if (!Header.IsEmpty())
+			{
+				OutSheet.ColumnIndex.Add(Header, Cell.Key - MinColumn);
+			}
+		}
+
+		int32 FirstDataRow = 1;
+		if (RawRows.Num() >= 2 && RawRows[1].RowNumber == HeaderRow.RowNumber + 1)
+		{
+			const FAbilityEditorSheetCell* FirstCell = RawRows[1].FindColumn(MinColumn);
+			if (!bDetectHintRow || SafeStr(FirstCell).IsEmpty())
+			{
+				FirstDataRow = 2;
+			}
+		}
+
+		OutSheet.Rows.Reserve(RawRows.Num() - FirstDataRow);
+		for (int32 RowIndex = FirstDataRow; RowIndex < RawRows.Num(); ++RowIndex)
+		{
+			FRawSheetRow& RawRow = RawRows[RowIndex];
+			if (RawRow.IsBlank())
+			{
+				continue;
+			}
+
+			TArray<FAbilityEditorSheetCell>& Row = OutSheet.Rows.AddDefaulted_GetRef();
+			Row.SetNum(RawRow.Cells.Last().Key - MinColumn + 1);
+			for (TPair<int32, FAbilityEditorSheetCell>& Cell : RawRow.Cells)
+			{
+				Row[Cell.Key - MinColumn] = MoveTemp(Cell.Value);
+			}
+		}
+	}
+
+	/** 单次顺序扫描工作表 XML（sheetData 中的 row / c / v / is） */
+	void ParseWorksheet(const TArray<uint8>& Xml, const TArray<FString>& SharedStrings, FAbilityEditorSheet& OutSheet)
+	{
+		TArray<FRawSheetRow> RawRows;
+		int32 MinColumn = MAX_int32;
+
+		FXmlScanner Scanner(Xml);
+		FXmlScanner::FTag Tag;
+		bool bInRow = false;
+		int32 LastColumn = INDEX_NONE;
+
+		// 当前单元格
+		bool bInCell = false;
+		int32 CellColumn = 0;
+		FAnsiStringView CellType;
+		FString CellValue;
+		bool bHasValue = false;
+		bool bInInlineString = false;
+		bool bInPhonetic = false;
+
+		auto FinishCell = [&]()
+		{
+			FAbilityEditorSheetCell Cell;
+			if (CellType.Equals("s"))
+			{
+				const int32 StringIndex = FCString::Atoi(*CellValue);
+				if (bHasValue && SharedStrings.IsValidIndex(StringIndex))
+				{
+					Cell.Type = ECellType::String;
+					Cell.Text = SharedStrings[StringIndex];
+				}
+			}
+			else if (CellType.Equals("inlineStr"))
+			{
+				Cell.Type = bHasValue ? ECellType::String : ECellType::Empty;
+				Cell.Text = MoveTemp(CellValue);
+			}
+			else if (CellType.Equals("b"))
+			{
+				Cell.Type = bHasValue ? ECellType::Boolean : ECellType::Empty;
+				Cell.Text = CellValue.TrimStartAndEnd() == TEXT("1") ? TEXT("1") : TEXT("0");
+			}
+			else if (CellType.Equals("str") || CellType.Equals("e") || CellType.Equals("d"))
+			{
+				Cell.Type = bHasValue ? ECellType::String : ECellType::Empty;
+				Cell.Text = MoveTemp(CellValue);
+			}
+			else
+			{
+				Cell.Text = CellValue.TrimStartAndEnd();
+				Cell.Type = Cell.Text.IsEmpty() ? ECellType::Empty : ECellType::Number;
+			}
+
+			if (Cell.Type != ECellType::Empty)
+			{
+				MinColumn = FMath::Min(MinColumn, CellColumn);
+				RawRows.Last().Cells.Emplace(CellColumn, MoveTemp(Cell));
+			}
+			bInCell = false;
+		};
+
+		while (Scanner.NextTag(Tag))
+		{
+			if (Tag.Name.Equals("row"))
+			{
+				if (Tag.bEnd)
+				{
+					bInRow = false;
+					continue;
+				}
+				const FAnsiStringView RowReference = FXmlScanner::FindAttribute(Tag.Attributes, "r");
+				FRawSheetRow& Row = RawRows.AddDefaulted_GetRef();
+				Row.RowNumber = RowReference.IsEmpty()
+					? (RawRows.Num() > 1 ? RawRows[RawRows.Num() - 2].RowNumber + 1 : 1)
+					: ParseDecimal(RowReference);
+				bInRow = !Tag.bEmpty;
+				LastColumn = INDEX_NONE;
+			}
+			else if (Tag.Name.Equals("c") && bInRow)
+			{
+				if (Tag.bEnd)
+				{
+					if (bInCell)
+					{
+						FinishCell();
+					}
+					continue;
+				}
+
+				const int32 ParsedColumn = ParseColumnIndex(FXmlScanner::FindAttribute(Tag.Attributes, "r"));
+				CellColumn = ParsedColumn != INDEX_NONE ? ParsedColumn : LastColumn + 1;
+				LastColumn = CellColumn;
+				CellType = FXmlScanner::FindAttribute(Tag.Attributes, "t");
+				CellValue.Reset();
+				bHasValue = false;
+				bInInlineString = false;
+				bInPhonetic = false;
+				bInCell = !Tag.bEmpty;
+			}
+			else if (!bInCell)
+			{
+				if (Tag.Name.Equals("sheetData") && Tag.bEnd)
+				{
+					break;
+				}
+			}
+			else if (Tag.Name.Equals("v") && !Tag.bEnd)
+			{
+				bHasValue = true;
+				CellValue = Tag.bEmpty ? FString() : DecodeXmlText(Scanner.ReadText());
+			}
+			else if (Tag.Name.Equals("is") && !Tag.bEmpty)
+			{
+				bInInlineString = !Tag.bEnd;
+				bHasValue = true;
+			}
+			else if (Tag.Name.Equals("rPh") && !Tag.bEmpty)
+			{
+				bInPhonetic = !Tag.bEnd;
+			}
+			else if (Tag.Name.Equals("t") && bInInlineString && !bInPhonetic && !Tag.bEnd && !Tag.bEmpty)
+			{
+				CellValue += DecodeXmlText(Scanner.ReadText());
+			}
+		}
+
+		// 没有任何单元格的行（仅有样式）保留行号，用于判断提示行
+		BuildSheet(RawRows, MinColumn == MAX_int32 ? 0 : MinColumn, true, OutSheet);
+	}
+
+	/** CSV（Python csv 模块默认方言：逗号分隔、双引号包裹、"" 转义） */
+	bool ParseCsvSheet(const FString& FilePath, FAbilityEditorSheet& OutSheet, FString& OutError)
+	{
+		FString Content;
+		if (!FFileHelper::LoadFileToString(Content, *FilePath))
+		{
+			OutError = FString::Printf(TEXT("无法读取 CSV 文件：%s"), *FilePath);
+			return false;
+		}
+		Content.ReplaceInline(TEXT("\r\n"), TEXT("\n"), ESearchCase::CaseSensitive);
+		Content.ReplaceInline(TEXT("\r"), TEXT("\n"), ESearchCase::CaseSensitive);
+
+		TArray<FRawSheetRow> RawRows;
+		FRawSheetRow* Row = nullptr;
+		FString Field;
+		bool bInQuotes = false;
+		bool bAtFieldStart = true;
+
+		auto FinishField = [&]()
+		{
+			if (!Row)
+			{
+				Row = &RawRows.AddDefaulted_GetRef();
+				Row->RowNumber = RawRows.Num();
+			}
+			FAbilityEditorSheetCell Cell;
+			Cell.Type = ECellType::String;
+			Cell.Text = MoveTemp(Field);
+			Row->Cells.Emplace(Row->Cells.Num(), MoveTemp(Cell));
+			Field.Reset();
+			bAtFieldStart = true;
+		};
+
+		for (int32 Index = 0; Index < Content.Len(); ++Index)
+		{
+			const TCHAR Char = Content[Index];
+			if (bInQuotes)
+			{
+				if (Char != TEXT('"'))
+				{
+					Field.AppendChar(Char);
+				}
+				else if (Index + 1 < Content.Len() && Content[Index + 1] == TEXT('"'))
+				{
+					Field.AppendChar(Char);
+					++Index;
+				}
+				else
+				{
+					bInQuotes = false;
+				}
+			}
+			else if (Char == TEXT('"') && bAtFieldStart)
+			{
+				bInQuotes = true;
+				bAtFieldStart = false;
+			}
+			else if (Char == TEXT(','))
+			{
+				FinishField();
+			}
+			else if (Char == TEXT('\n'))
+			{
+				FinishField();
+				Row = nullptr;
+			}
+			else
+			{
+				Field.AppendChar(Char);
+				bAtFieldStart = false;
+			}
+		}
+		if (!bAtFieldStart || !Field.IsEmpty() || Row)
+		{
+			FinishField();
+		}
+
+		BuildSheet(RawRows, 0, false, OutSheet);
+		return true;
+	}
+
+#if WITH_EDITOR
+	TUniquePtr<FZipArchiveReader> OpenZip(const FString& FilePath)
+	{
+		IFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath);
+		if (!FileHandle)
+		{
+			return nullptr;
+		}
+
+		// FZipArchiveReader 接管文件句柄
+		TUniquePtr<FZipArchiveReader> Zip = MakeUnique<FZipArchiveReader>(FileHandle);
+		return Zip->IsValid() ? MoveTemp(Zip) : nullptr;
+	}
+
+	/** 关系文件中的 Target 转为 zip 内路径（相对 xl/，或以 / 开头的绝对路径） */
+	FString ResolvePartPath(const FString& Target)
+	{
+		return Target.StartsWith(TEXT("/")) ? Target.Mid(1) : FString(TEXT("xl/")) + Target;
+	}
+#endif
+}
+
+// ===================== FAbilityEditorSheet =====================
+
+const FAbilityEditorSheetCell* FAbilityEditorSheet::FindCell(int32 RowIndex, const FString& Header) const
+{
+	const int32* Column = ColumnIndex.Find(Header);
+	if (!Column || !Rows.IsValidIndex(RowIndex) || !Rows[RowIndex].IsValidIndex(*Column))
+	{
+		return nullptr;
+	}
+	return &Rows[RowIndex][*Column];
+}
+
+// ===================== FAbilityEditorSpreadsheetRowReader =====================
+
+bool FAbilityEditorSpreadsheetRowReader::IsSpreadsheetFile(const FString& FilePath)
+{
+	const FString Extension = FPaths::GetExtension(FilePath);
+	return Extension.Equals(TEXT("xlsx"), ESearchCase::IgnoreCase)
+		|| Extension.Equals(TEXT("xlsm"), ESearchCase::IgnoreCase)
+		|| Extension.Equals(TEXT("csv"), ESearchCase::IgnoreCase);
+}
+
+bool FAbilityEditorSpreadsheetRowReader::Open(const FString& InPath, const UScriptStruct* InRowStruct)
+{
+	Path = InPath;
+	RowStruct = InRowStruct;
+	if (!RowStruct)
+	{
+		return SetError(TEXT("行结构为空"));
+	}
+
+	bCsvLayout = FPaths::GetExtension(Path).Equals(TEXT("csv"), ESearchCase::IgnoreCase) || FPaths::DirectoryExists(Path);
+	if (bCsvLayout)
+	{
+		const FString BaseDir = FPaths::DirectoryExists(Path) ? Path : FPaths::GetPath(Path);
+		if (!FPaths::DirectoryExists(BaseDir))
+		{
+			return SetError(FString::Printf(TEXT("CSV 目录不存在：%s"), *BaseDir));
+		}
+	}
+	else if (!IsSpreadsheetFile(Path))
+	{
+		return SetError(FString::Printf(TEXT("不支持的文件类型：%s（期望 .xlsx/.xlsm/.csv 或 CSV 目录）"), *Path));
+	}
+	else if (!FPaths::FileExists(Path))
+	{
+		return SetError(FString::Printf(TEXT("Excel 文件不存在：%s"), *Path));
+	}
+
+	// 按字段规则划分主表字段、ExcelSheet 子表与 array<struct> 子表（字段顺序与 Schema 一致）
+	MainSheetName = RowStruct->GetName();
+	for (TFieldIterator<FProperty> It(RowStruct, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (Property->GetBoolMetaData(TEXT("ExcelIgnore")))
+		{
+			continue;
+		}
+
+		const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+		if (ArrayProperty && !IsPrimitiveArray(ArrayProperty))
+		{
+			FChildSheet& Child = ChildSheets.AddDefaulted_GetRef();
+			Child.ArrayProperty = ArrayProperty;
+			Child.InnerStruct = CastFieldChecked<FStructProperty>(ArrayProperty->Inner)->Struct;
+			for (TFieldIterator<FProperty> InnerIt(Child.InnerStruct, EFieldIteratorFlags::IncludeSuper); InnerIt; ++InnerIt)
+			{
+				if (!InnerIt->GetBoolMetaData(TEXT("ExcelIgnore")) && !CastField<FArrayProperty>(*InnerIt))
+				{
+					Child.InnerFields.Add({ *InnerIt, GetColumnName(*InnerIt) });
+				}
+			}
+			continue;
+		}
+
+		const FString ExcelSheet = Property->GetMetaData(TEXT("ExcelSheet")).TrimStartAndEnd();
+		if (!ExcelSheet.IsEmpty())
+		{
+			FExtensionSheet* Extension = ExtensionSheets.FindByPredicate([&ExcelSheet](const FExtensionSheet& Existing) { return Existing.SheetName == ExcelSheet; });
+			if (!Extension)
+			{
+				Extension = &ExtensionSheets.AddDefaulted_GetRef();
+				Extension->SheetName = ExcelSheet;
+			}
+			Extension->Fields.Add({ Property, GetColumnName(Property) });
+			continue;
+		}
+
+		if (Property->GetName() != TEXT("Name"))
+		{
+			MainFields.Add({ Property, GetColumnName(Property) });
+		}
+	}
+	return true;
+}
+
+bool FAbilityEditorSpreadsheetRowReader::ReadNextRow(FAbilityEditorJsonRow& OutRow)
+{
+	OutRow.Reset();
+	if (HasError() || !RowStruct)
+	{
+		return false;
+	}
+
+	// 第一次读取时才解析文件：异步导入中这一步在工作线程执行
+	if (!bLoaded)
+	{
+		bLoaded = true;
+		if (!Load())
+		{
+			return false;
+		}
+	}
+
+	while (NextMainRow < MainSheet->Rows.Num())
+	{
+		const int32 RowIndex = NextMainRow++;
+		const FString Name = SafeStr(MainSheet->FindCell(RowIndex, TEXT("Name")));
+		if (Name.IsEmpty() || Name == TEXT("Name"))
+		{
+			continue;
+		}
+
+		FAbilityEditorJsonTokenWriter Writer(OutRow.Tokens);
+		Writer.BeginObject(FString());
+		Writer.String(TEXT("Name"), Name);
+
+		// 主表：非数组字段与基本类型数组
+		for (const FColumnField& Field : MainFields)
+		{
+			const FAbilityEditorSheetCell* Cell = MainSheet->FindCell(RowIndex, Field.Column);
+			if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Field.Property))
+			{
+				WritePrimitiveArray(Writer, Field.Property->GetName(), ArrayProperty, Cell);
+			}
+			else
+			{
+				WriteScalar(Writer, Field.Property->GetName(), Field.Property, Cell);
+			}
+		}
+
+		// ExcelSheet 子表：没有对应行时各字段取空值
+		for (const FExtensionSheet& Extension : ExtensionSheets)
+		{
+			const int32* ExtensionRow = Extension.RowByParent.Find(Name);
+			for (const FColumnField& Field : Extension.Fields)
+			{
+				const FAbilityEditorSheetCell* Cell = ExtensionRow ? Extension.Sheet->FindCell(*ExtensionRow, Field.Column) : nullptr;
+				if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Field.Property))
+				{
+					WritePrimitiveArray(Writer, Field.Property->GetName(), ArrayProperty, Cell);
+				}
+				else
+				{
+					WriteScalar(Writer, Field.Property->GetName(), Field.Property, Cell);
+				}
+			}
+		}
+
+		// array<struct> 子表：按出现顺序组成数组
+		for (const FChildSheet& Child : ChildSheets)
+		{
+			Writer.BeginArray(Child.ArrayProperty->GetName());
+			if (const TArray<int32>* ChildRows = Child.RowsByParent.Find(Name))
+			{
+				for (const int32 ChildRow : *ChildRows)
+				{
+					Writer.BeginObject(FString());
+					for (const FColumnField& Field : Child.InnerFields)
+					{
+						WriteScalar(Writer, Field.Property->GetName(), Field.Property, Child.Sheet->FindCell(ChildRow, Field.Column));
+					}
+					Writer.EndObject();
+				}
+			}
+			Writer.EndArray();
+		}
+
+		Writer.EndObject();
+		OutRow.Name = Name;
+		return true;
+	}
+	return false;
+}
+
+bool FAbilityEditorSpreadsheetRowReader::Load()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (bCsvLayout)
+	{
+		if (!LoadCsvDirectory())
+		{
+			return false;
+		}
+	}
+	else
+	{
+		// 只解析会用到的工作表：主表与各子表的两种命名
+		TArray<FString> WantedSheets;
+		WantedSheets.Add(MainSheetName);
+		auto AddSubSheet = [this, &WantedSheets](const FString& SubName)
+		{
+			WantedSheets.AddUnique(TruncateSheetName(SubName));
+			WantedSheets.AddUnique(TruncateSheetName(MainSheetName + TEXT(".") + SubName));
+		};
+		for (const FExtensionSheet& Extension : ExtensionSheets)
+		{
+			AddSubSheet(Extension.SheetName);
+		}
+		for (const FChildSheet& Child : ChildSheets)
+		{
+			AddSubSheet(Child.ArrayProperty->GetName());
+		}
+
+		if (!LoadWorkbook(WantedSheets))
+		{
+			return false;
+		}
+	}
+
+	MainSheet = Sheets.Find(MainSheetName);
+	if (!MainSheet)
+	{
+		return SetError(FString::Printf(TEXT("%s 中没有主表 %s"), *Path, *MainSheetName));
+	}
+
+	// 子表按 ParentName 建立索引
+	for (FExtensionSheet& Extension : ExtensionSheets)
+	{
+		Extension.Sheet = FindSubSheet(Extension.SheetName);
+		for (int32 RowIndex = 0; Extension.Sheet && RowIndex < Extension.Sheet->Rows.Num(); ++RowIndex)
+		{
+			const FString ParentName = SafeStr(Extension.Sheet->FindCell(RowIndex, TEXT("ParentName")));
+			if (!ParentName.IsEmpty())
+			{
+				// 每个 ParentName 只取一行，重复时以最后一行为准
+				Extension.RowByParent.Add(ParentName, RowIndex);
+			}
+		}
+	}
+	for (FChildSheet& Child : ChildSheets)
+	{
+		Child.Sheet = FindSubSheet(Child.ArrayProperty->GetName());
+		for (int32 RowIndex = 0; Child.Sheet && RowIndex < Child.Sheet->Rows.Num(); ++RowIndex)
+		{
+			const FString ParentName = SafeStr(Child.Sheet->FindCell(RowIndex, TEXT("ParentName")));
+			if (!ParentName.IsEmpty())
+			{
+				Child.RowsByParent.FindOrAdd(ParentName).Add(RowIndex);
+			}
+		}
+	}
+
+	UE_LOG(LogAbilityEditor, Log, TEXT("[AbilityEditorHelper] 已读取 %s：%d 张工作表，主表 %d 行，耗时 %.2f 秒"),
+		*Path, Sheets.Num(), MainSheet->Rows.Num(), FPlatformTime::Seconds() - StartTime);
+	return true;
+}
+
+bool FAbilityEditorSpreadsheetRowReader::LoadWorkbook(const TArray<FString>& WantedSheets)
+{
+#if WITH_EDITOR
+	TUniquePtr<FZipArchiveReader> Zip = OpenZip(Path);
+	if (!Zip)
+	{
+		return SetError(FString::Printf(TEXT("无法打开工作簿（不是有效的 xlsx 文件或正被占用）：%s"), *Path));
+	}
+
+	TArray<uint8> WorkbookXml;
+	TArray<uint8> RelationshipsXml;
+	if (!Zip->TryReadFile(TEXT("xl/workbook.xml"), WorkbookXml) || !Zip->TryReadFile(TEXT("xl/_rels/workbook.xml.rels"), RelationshipsXml))
+	{
+		return SetError(FString::Printf(TEXT("工作簿结构不完整（缺少 xl/workbook.xml）：%s"), *Path));
+	}
+
+	// 关系 Id -> 部件路径
+	TMap<FString, FString> PartsById;
+	FString SharedStringsPart = TEXT("xl/sharedStrings.xml");
+	{
+		FXmlScanner Scanner(RelationshipsXml);
+		FXmlScanner::FTag Tag;
+		while (Scanner.NextTag(Tag))
+		{
+			if (!Tag.Name.Equals("Relationship") || Tag.bEnd)
+			{
+				continue;
+			}
+			const FString Target = ResolvePartPath(DecodeXmlText(FXmlScanner::FindAttribute(Tag.Attributes, "Target")));
+			PartsById.Add(DecodeXmlText(FXmlScanner::FindAttribute(Tag.Attributes, "Id")), Target);
+			if (DecodeXmlText(FXmlScanner::FindAttribute(Tag.Attributes, "Type")).EndsWith(TEXT("/sharedStrings")))
+			{
+				SharedStringsPart = Target;
+			}
+		}
+	}
+
+	// 工作表名 -> 部件路径（只保留需要的）
+	struct FSheetJob
+	{
+		FString SheetName;
+		FString PartPath;
+		FAbilityEditorSheet Sheet;
+		bool bRead = false;
+	};
+	TArray<FSheetJob> Jobs;
+	{
+		FXmlScanner Scanner(WorkbookXml);
+		FXmlScanner::FTag Tag;
+		while (Scanner.NextTag(Tag))
+		{
+			if (!Tag.Name.Equals("sheet") || Tag.bEnd)
+			{
+				continue;
+			}
+			const FString SheetName = DecodeXmlText(FXmlScanner::FindAttribute(Tag.Attributes, "name"));
+			const FString* PartPath = PartsById.Find(DecodeXmlText(FXmlScanner::FindAttribute(Tag.Attributes, "id")));
+			if (PartPath && WantedSheets.Contains(SheetName))
+			{
+				FSheetJob& Job = Jobs.AddDefaulted_GetRef();
+				Job.SheetName = SheetName;
+				Job.PartPath = *PartPath;
+			}
+		}
+	}
+
+	TArray<FString> SharedStrings;
+	{
+		TArray<uint8> SharedStringsXml;
+		if (Zip->TryReadFile(SharedStringsPart, SharedStringsXml))
+		{
+			ParseSharedStrings(SharedStringsXml, SharedStrings);
+		}
+	}
+	Zip.Reset();
+
+	// 按表并行解压与解析：每个任务使用自己的 zip 读取器（读取器不支持并发访问）
+	ParallelFor(Jobs.Num(), [this, &Jobs, &SharedStrings](int32 Index)
+	{
+		FSheetJob& Job = Jobs[Index];
+		TUniquePtr<FZipArchiveReader> SheetZip = OpenZip(Path);
+		TArray<uint8> SheetXml;
+		if (SheetZip && SheetZip->TryReadFile(Job.PartPath, SheetXml))
+		{
+			ParseWorksheet(SheetXml, SharedStrings, Job.Sheet);
+			Job.bRead = true;
+		}
+	});
+
+	for (FSheetJob& Job : Jobs)
+	{
+		if (!Job.bRead)
+		{
+			return SetError(FString::Printf(TEXT("无法读取工作表 %s（%s）：%s"), *Job.SheetName, *Job.PartPath, *Path));
+		}
+		Sheets.Add(Job.SheetName, MoveTemp(Job.Sheet));
+	}
+	return true;
+#else
+	return SetError(TEXT("此功能仅在编辑器环境下可用"));
+#endif
+}
+
+bool FAbilityEditorSpreadsheetRowReader::LoadCsvDirectory()
+{
+	// CSV 目录布局：<行结构名>.csv 为主表，<行结构名>.<字段名>.csv 为 array<struct> 子表
+	const FString BaseDir = FPaths::DirectoryExists(Path) ? Path : FPaths::GetPath(Path);
+
+	struct FCsvJob
+	{
+		FString SheetName;
+		FString FilePath;
+		FAbilityEditorSheet Sheet;
+		FString Error;
+		bool bRead = false;
+	};
+	TArray<FCsvJob> Jobs;
+
+	const FString MainFile = FPaths::Combine(BaseDir, MainSheetName + TEXT(".csv"));
+	if (!FPaths::FileExists(MainFile))
+	{
+		return SetError(FString::Printf(TEXT("主表 CSV 不存在：%s"), *MainFile));
+	}
+	Jobs.AddDefaulted_GetRef().SheetName = MainSheetName;
+	Jobs.Last().FilePath = MainFile;
+
+	for (const FChildSheet& Child : ChildSheets)
+	{
+		const FString SheetName = MainSheetName + TEXT(".") + Child.ArrayProperty->GetName();
+		const FString FilePath = FPaths::Combine(BaseDir, SheetName + TEXT(".csv"));
+		if (FPaths::FileExists(FilePath))
+		{
+			FCsvJob& Job = Jobs.AddDefaulted_GetRef();
+			Job.SheetName = SheetName;
+			Job.FilePath = FilePath;
+		}
+	}
+
+	ParallelFor(Jobs.Num(), [&Jobs](int32 Index)
+	{
+		FCsvJob& Job = Jobs[Index];
+		Job.bRead = ParseCsvSheet(Job.FilePath, Job.Sheet, Job.Error);
+	});
+
+	for (FCsvJob& Job : Jobs)
+	{
+		if (!Job.bRead)
+		{
+			return SetError(Job.Error);
+		}
+		Sheets.Add(Job.SheetName, MoveTemp(Job.Sheet));
+	}
+	return true;
+}
+
+const FAbilityEditorSheet* FAbilityEditorSpreadsheetRowReader::FindSubSheet(const FString& SubName) const
+{
+	// 优先新格式（只有字段名）；不存在或为空时再尝试旧格式
+	const FAbilityEditorSheet* Sheet = Sheets.Find(TruncateSheetName(SubName));
+	if (Sheet && Sheet->Rows.Num() > 0)
+	{
+		return Sheet;
+	}
+	const FAbilityEditorSheet* LegacySheet = Sheets.Find(TruncateSheetName(MainSheetName + TEXT(".") + SubName));
+	return LegacySheet ? LegacySheet : Sheet;
+}
+
+bool FAbilityEditorSpreadsheetRowReader::SetError(const FString& InMessage)
+{
+	ErrorMessage = InMessage;
+	return false;
+}
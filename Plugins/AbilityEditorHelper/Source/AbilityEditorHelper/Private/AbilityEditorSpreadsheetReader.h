@@ -0,0 +1,117 @@
+// AbilityEditorSpreadsheetReader.h
+// 原生 xlsx / CSV 行读取（替代 Python 的 export_excel_to_json_using_schema + 中间 JSON 文件）
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilityEditorJsonRowReader.h"
+
+/** 工作表中的一个单元格（值类型与 openpyxl data_only 读出的一致） */
+struct FAbilityEditorSheetCell
+{
+	enum class EType : uint8
+	{
+		/** 空单元格（对应 Python 的 None） */
+		Empty,
+		String,
+		/** Text 为单元格中记录的原始数字文本 */
+		Number,
+		/** Text 为 "1" 或 "0" */
+		Boolean,
+	};
+
+	EType Type = EType::Empty;
+	FString Text;
+};
+
+/** 一张工作表：表头与数据行（已去掉表头、提示行与整行为空的行） */
+struct FAbilityEditorSheet
+{
+	/** 表头 -> 列索引（表头重名时以最后一列为准） */
+	TMap<FString, int32> ColumnIndex;
+
+	TArray<TArray<FAbilityEditorSheetCell>> Rows;
+
+	/** 按表头查找单元格，列不存在或该行没有这一列时返回 nullptr */
+	const FAbilityEditorSheetCell* FindCell(int32 RowIndex, const FString& Header) const;
+};
+
+/**
+ * 直接读取 xlsx 工作簿或 CSV 目录，按与 Python 工具相同的约定组装行：
+ * - 主表：工作表名为行结构名，Name 列为行名；非数组字段与基本类型数组（逗号/分号分隔）在主表
+ * - array<struct> 字段：子表（工作表名为字段名，或旧格式 "<行结构名>.<字段名>"），按 ParentName 聚合为数组
+ * - 带 ExcelSheet 元数据的字段：子表按 ParentName 各取一行
+ * - ExcelName / ExcelIgnore 元数据、特殊结构（TagContainer、Attribute、TagRequirements 等）的单元格写法同 Python 工具
+ * 每行产出与 Python 工具导出的 JSON 对象等价的 Token 序列，交给增量导入逐批并行绑定到行结构内存，不再生成中间 JSON 文件
+ * 工作表在第一次 ReadNextRow 时按表并行解压与解析（可在工作线程执行）；工作表 XML 单次顺序扫描，不构建 DOM
+ * 字段规则读取属性元数据，仅编辑器可用
+ */
+class FAbilityEditorSpreadsheetRowReader : public FAbilityEditorRowSource
+{
+public:
+	/**
+	 * 校验输入并根据行结构确定需要读取的工作表（不读取文件内容）
+	 * @param InPath       .xlsx / .xlsm 工作簿；.csv 文件或目录表示 CSV 目录布局（<行结构名>.csv 与 <行结构名>.<字段名>.csv）
+	 * @param InRowStruct  DataTable 的行结构
+	 */
+	bool Open(const FString& InPath, const UScriptStruct* InRowStruct);
+
+	virtual bool ReadNextRow(FAbilityEditorJsonRow& OutRow) override;
+
+	/** 路径是否应由本读取器处理（.xlsx / .xlsm / .csv） */
+	static bool IsSpreadsheetFile(const FString& FilePath);
+
+private:
+	/** 字段及其在表头中的列名（ExcelName 元数据，缺省为字段名） */
+	struct FColumnField
+	{
+		const FProperty* Property = nullptr;
+		FString Column;
+	};
+
+	/** ExcelSheet 子表：每个 ParentName 一行 */
+	struct FExtensionSheet
+	{
+		FString SheetName;
+		TArray<FColumnField> Fields;
+		const FAbilityEditorSheet* Sheet = nullptr;
+		TMap<FString, int32> RowByParent;
+	};
+
+	/** array<struct> 子表：每个 ParentName 若干行 */
+	struct FChildSheet
+	{
+		const FArrayProperty* ArrayProperty = nullptr;
+		const UScriptStruct* InnerStruct = nullptr;
+		TArray<FColumnField> InnerFields;
+		const FAbilityEditorSheet* Sheet = nullptr;
+		TMap<FString, TArray<int32>> RowsByParent;
+	};
+
+	/** 解压并解析所需的工作表，建立子表的 ParentName 索引 */
+	bool Load();
+
+	bool LoadWorkbook(const TArray<FString>& WantedSheets);
+	bool LoadCsvDirectory();
+
+	/** 在已加载的工作表中按 Python 工具的顺序查找子表（先字段名，再 "<行结构名>.<字段名>"，均按 31 字符截断） */
+	const FAbilityEditorSheet* FindSubSheet(const FString& SubName) const;
+
+	bool SetError(const FString& InMessage);
+
+	FString Path;
+	bool bCsvLayout = false;
+	const UScriptStruct* RowStruct = nullptr;
+	FString MainSheetName;
+
+	TArray<FColumnField> MainFields;
+	TArray<FExtensionSheet> ExtensionSheets;
+	TArray<FChildSheet> ChildSheets;
+
+	/** 工作表名 -> 工作表（CSV 布局中为文件名去掉 .csv） */
+	TMap<FString, FAbilityEditorSheet> Sheets;
+	const FAbilityEditorSheet* MainSheet = nullptr;
+
+	int32 NextMainRow = 0;
+	bool bLoaded = false;
+};
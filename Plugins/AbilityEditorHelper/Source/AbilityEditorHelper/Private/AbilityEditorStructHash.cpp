@@ -0,0 +1,180 @@
+// AbilityEditorStructHash.cpp
+
+#include "AbilityEditorStructHash.h"
+#include "GameplayTagContainer.h"
+#include "Hash/xxhash.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+
+namespace
+{
+	void HashStructInto(FXxHash64Builder& Builder, const UStruct* Struct, const void* StructData);
+	void HashValueInto(FXxHash64Builder& Builder, const FProperty* Property, const void* ValuePtr);
+
+	void HashCount(FXxHash64Builder& Builder, int32 Count)
+	{
+		Builder.Update(&Count, sizeof(Count));
+	}
+
+	void HashString(FXxHash64Builder& Builder, const FString& Value)
+	{
+		const int32 Len = Value.Len();
+		HashCount(Builder, Len);
+		Builder.Update(*Value, Len * sizeof(TCHAR));
+	}
+
+	void HashValueInto(FXxHash64Builder& Builder, const FProperty* Property, const void* ValuePtr)
+	{
+		// 位域布尔需要通过属性读取
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			const uint8 Value = BoolProperty->GetPropertyValue(ValuePtr) ? 1 : 0;
+			Builder.Update(&Value, sizeof(Value));
+			return;
+		}
+
+		// 数值与枚举：直接对内存做哈希
+		if (Property->IsA<FNumericProperty>() || Property->IsA<FEnumProperty>())
+		{
+			Builder.Update(ValuePtr, Property->GetElementSize());
+			return;
+		}
+
+		if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+		{
+			HashString(Builder, StrProperty->GetPropertyValue(ValuePtr));
+			return;
+		}
+
+		if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+		{
+			HashString(Builder, NameProperty->GetPropertyValue(ValuePtr).ToString());
+			return;
+		}
+
+		if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+		{
+			HashString(Builder, TextProperty->GetPropertyValue(ValuePtr).ToString());
+			return;
+		}
+
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if (StructProperty->Struct == FGameplayTagContainer::StaticStruct())
+			{
+				// ParentTags 由 GameplayTags 推导，只哈希显式标签
+				const FGameplayTagContainer& Container = *static_cast<const FGameplayTagContainer*>(ValuePtr);
+				HashCount(Builder, Container.Num());
+				for (const FGameplayTag& Tag : Container)
+				{
+					HashString(Builder, Tag.GetTagName().ToString());
+				}
+				return;
+			}
+
+			HashStructInto(Builder, StructProperty->Struct, ValuePtr);
+			return;
+		}
+
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+			HashCount(Builder, Helper.Num());
+			for (int32 Index = 0; Index < Helper.Num(); ++Index)
+			{
+				HashValueInto(Builder, ArrayProperty->Inner, Helper.GetRawPtr(Index));
+			}
+			return;
+		}
+
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			FScriptSetHelper Helper(SetProperty, ValuePtr);
+			HashCount(Builder, Helper.Num());
+			for (FScriptSetHelper::FIterator It(Helper); It; ++It)
+			{
+				HashValueInto(Builder, SetProperty->ElementProp, Helper.GetElementPtr(It));
+			}
+			return;
+		}
+
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			FScriptMapHelper Helper(MapProperty, ValuePtr);
+			HashCount(Builder, Helper.Num());
+			for (FScriptMapHelper::FIterator It(Helper); It; ++It)
+			{
+				HashValueInto(Builder, MapProperty->KeyProp, Helper.GetKeyPtr(It));
+				HashValueInto(Builder, MapProperty->ValueProp, Helper.GetValuePtr(It));
+			}
+			return;
+		}
+
+		// 其余（对象引用、软引用、接口等）：按导出文本哈希
+		FString ExportedText;
+		Property->ExportTextItem_Direct(ExportedText, ValuePtr, nullptr, nullptr, PPF_None);
+		HashString(Builder, ExportedText);
+	}
+
+	void HashStructInto(FXxHash64Builder& Builder, const UStruct* Struct, const void* StructData)
+	{
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			const FProperty* Property = *It;
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				HashValueInto(Builder, Property, Property->ContainerPtrToValuePtr<void>(StructData, ArrayIndex));
+			}
+		}
+	}
+}
+
+uint64 FAbilityEditorStructHash::HashStruct(const UScriptStruct* Struct, const void* StructData)
+{
+	if (!Struct || !StructData)
+	{
+		return 0;
+	}
+
+	FXxHash64Builder Builder;
+	HashStructInto(Builder, Struct, StructData);
+	return Builder.Finalize().Hash;
+}
+
+uint64 FAbilityEditorStructHash::HashObjectProperties(const UObject* Object)
+{
+	if (!Object)
+	{
+		return 0;
+	}
+
+	FXxHash64Builder Builder;
+	HashStructInto(Builder, Object->GetClass(), Object);
+	return Builder.Finalize().Hash;
+}
+
+uint64 FAbilityEditorStructHash::HashObjectProperties(const UObject* Object, TConstArrayView<FName> PropertyNames)
+{
+	if (!Object)
+	{
+		return 0;
+	}
+
+	FXxHash64Builder Builder;
+	for (const FName PropertyName : PropertyNames)
+	{
+		const FProperty* Property = Object->GetClass()->FindPropertyByName(PropertyName);
+		if (!Property)
+		{
+			continue;
+		}
+
+		HashString(Builder, PropertyName.ToString());
+		for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+		{
+			HashValueInto(Builder, Property, Property->ContainerPtrToValuePtr<void>(Object, ArrayIndex));
+		}
+	}
+	return Builder.Finalize().Hash;
+}
@@ -0,0 +1,168 @@
+// AbilityEditorAsyncImport.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Templates/SharedPointer.h"
+#include "AbilityEditorAsyncImport.generated.h"
+
+class FAbilityEditorImportJob;
+class SNotificationItem;
+class UPackage;
+
+/**
+ * 异步导入事件
+ * @param ProcessedSteps  已处理的行数（统一导入中循环引用的行计两次）
+ * @param TotalSteps      总行数（数据阶段尚未结束时为 0）
+ * @param bSuccess        导入是否全部成功（仅 OnCompleted 有意义）
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FAbilityEditorAsyncImportEvent, int32, ProcessedSteps, int32, TotalSteps, bool, bSuccess);
+
+/**
+ * 异步导入（Blueprint 异步节点，C++ 中返回的对象即导入句柄）
+ * 与同名的同步接口共用同一份导入实现，区别在于执行方式：
+ * - 纯数据阶段（JSON 读取、绑定与比较）在工作线程执行；行结构含硬引用对象属性时改为在游戏线程逐批执行
+ * - 资产生成阶段按 Settings 的 AsyncImportFrameBudgetMs 分摊到多帧，每帧处理若干行后把控制权交还编辑器
+ * - 导入期间显示带进度与"取消"按钮的通知；取消在两行之间生效，已生成的资产保留（配置印记使下次导入跳过它们）
+ * - 同一时间只允许一个异步导入，期间同步导入接口也会拒绝执行
+ * 仅编辑器可用
+ */
+UCLASS(meta = (ExposedAsyncProxy = AsyncImport))
+class ABILITYEDITORHELPER_API UAbilityEditorAsyncImport : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/** 每帧执行完一批步骤后广播 */
+	UPROPERTY(BlueprintAssignable)
+	FAbilityEditorAsyncImportEvent OnProgress;
+
+	/** 导入结束（含输入未变化而直接返回）后广播 */
+	UPROPERTY(BlueprintAssignable)
+	FAbilityEditorAsyncImportEvent OnCompleted;
+
+	/** 导入被取消后广播（已处理的行已生效） */
+	UPROPERTY(BlueprintAssignable)
+	FAbilityEditorAsyncImportEvent OnCancelled;
+
+	/** CreateOrUpdateGameplayEffectsFromSettings 的异步版本 */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Create Or Update GameplayEffects From Settings (Async)"))
+	static UAbilityEditorAsyncImport* CreateOrUpdateGameplayEffectsFromSettingsAsync(bool bClearGameplayEffectFolderFirst = false, bool bForceFullUpdate = false);
+
+	/** CreateOrUpdateGameplayAbilitiesFromSettings 的异步版本 */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Create Or Update GameplayAbilities From Settings (Async)"))
+	static UAbilityEditorAsyncImport* CreateOrUpdateGameplayAbilitiesFromSettingsAsync(bool bClearGameplayAbilityFolderFirst = false, bool bForceFullUpdate = false);
+
+	/** CreateOrUpdateGameplayEffectsAndAbilitiesFromSettings 的异步版本 */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Create Or Update GameplayEffects And Abilities From Settings (Async)"))
+	static UAbilityEditorAsyncImport* CreateOrUpdateGameplayEffectsAndAbilitiesFromSettingsAsync(bool bClearFoldersFirst = false, bool bForceFullUpdate = false);
+
+	/** ImportAndUpdateGameplayEffectsFromJson 的异步版本（变化的行名通过 GetUpdatedRowNames 获取） */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Import And Update GameplayEffects From JSON (Async)"))
+	static UAbilityEditorAsyncImport* ImportAndUpdateGameplayEffectsFromJsonAsync(const FString& JsonFileName, bool bClearGameplayEffectFolderFirst = false);
+
+	/** ImportAndUpdateGameplayAbilitiesFromJson 的异步版本（变化的行名通过 GetUpdatedRowNames 获取） */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Import And Update GameplayAbilities From JSON (Async)"))
+	static UAbilityEditorAsyncImport* ImportAndUpdateGameplayAbilitiesFromJsonAsync(const FString& JsonFileName, bool bClearGameplayAbilityFolderFirst = false);
+
+	/** ImportAndUpdateGameplayEffectsFromExcel 的异步版本（工作簿在数据阶段读取，可在工作线程执行） */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Import And Update GameplayEffects From Excel (Async)"))
+	static UAbilityEditorAsyncImport* ImportAndUpdateGameplayEffectsFromExcelAsync(const FString& ExcelFileName, bool bClearGameplayEffectFolderFirst = false);
+
+	/** ImportAndUpdateGameplayAbilitiesFromExcel 的异步版本 */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Import And Update GameplayAbilities From Excel (Async)"))
+	static UAbilityEditorAsyncImport* ImportAndUpdateGameplayAbilitiesFromExcelAsync(const FString& ExcelFileName, bool bClearGameplayAbilityFolderFirst = false);
+
+	/** CreateOrUpdateRowTypeAssets 的异步版本（项目注册的行类型） */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Create Or Update Row Type Assets (Async)"))
+	static UAbilityEditorAsyncImport* CreateOrUpdateRowTypeAssetsAsync(FName RowType, bool bClearFolderFirst = false, bool bForceFullUpdate = false);
+
+	/** ImportAndUpdateRowTypeFromJson 的异步版本 */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Import And Update Row Type From JSON (Async)"))
+	static UAbilityEditorAsyncImport* ImportAndUpdateRowTypeFromJsonAsync(FName RowType, const FString& JsonFileName, bool bClearFolderFirst = false);
+
+	/** ImportAndUpdateRowTypeFromExcel 的异步版本 */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Import And Update Row Type From Excel (Async)"))
+	static UAbilityEditorAsyncImport* ImportAndUpdateRowTypeFromExcelAsync(FName RowType, const FString& ExcelFileName, bool bClearFolderFirst = false);
+
+	/** 请求取消：在当前行处理完后停止（数据阶段在当前批结束后停止） */
+	UFUNCTION(BlueprintCallable, Category = "AbilityEditorHelper|Async")
+	void Cancel();
+
+	/** 导入是否仍在进行 */
+	UFUNCTION(BlueprintPure, Category = "AbilityEditorHelper|Async")
+	bool IsRunning() const { return Phase != EPhase::Idle && Phase != EPhase::Finished; }
+
+	/** 进度 [0, 1]（数据阶段为 0） */
+	UFUNCTION(BlueprintPure, Category = "AbilityEditorHelper|Async")
+	float GetProgress() const;
+
+	/** JSON 导入中新增或变化的行（数据阶段结束后有效） */
+	UFUNCTION(BlueprintPure, Category = "AbilityEditorHelper|Async")
+	TArray<FName> GetUpdatedRowNames() const { return UpdatedRowNames; }
+
+	/** 当前是否有异步导入在进行 */
+	UFUNCTION(BlueprintPure, Category = "AbilityEditorHelper|Async")
+	static bool IsAnyImportRunning();
+
+	// UBlueprintAsyncActionBase
+	virtual void Activate() override;
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		/** 数据阶段在工作线程执行 */
+		DataBackground,
+		/** 数据阶段在游戏线程逐批执行 */
+		DataGameThread,
+		/** 逐行生成资产 */
+		Assets,
+		Finished,
+	};
+
+	static UAbilityEditorAsyncImport* Create(const TSharedRef<FAbilityEditorImportJob>& InJob);
+
+	bool Tick(float DeltaTime);
+
+	/** 数据阶段结束后进入资产阶段 */
+	bool BeginAssetStage();
+
+	/** 在一个批量导入作用域内执行步骤直到帧预算用完，并记录作用域内变化的包 */
+	void RunAssetSteps(double Deadline);
+
+	/** 资产阶段结束（或取消）：在新的最外层作用域中调用任务的 Finish */
+	void Complete(bool bCancelled);
+
+	/** 广播结果、关闭通知并释放 */
+	void EndImport(bool bSuccess, bool bCancelled);
+
+	void ShowNotification();
+	void UpdateNotification();
+	void CloseNotification(bool bSuccess, bool bCancelled);
+
+	TSharedPtr<FAbilityEditorImportJob> Job;
+	EPhase Phase = EPhase::Idle;
+
+	/** 工作线程上的数据阶段 */
+	UE::Tasks::TTask<bool> DataTask;
+
+	/** 取消请求（工作线程在批与批之间读取） */
+	TSharedPtr<FThreadSafeBool, ESPMode::ThreadSafe> CancelRequested;
+
+	int32 NumSteps = 0;
+	int32 NumStepsDone = 0;
+
+	/** JSON 导入中新增或变化的行（数据阶段结束时从任务复制） */
+	TArray<FName> UpdatedRowNames;
+
+	/** 各帧批量导入作用域中变化的包，结束时统一保存 */
+	TArray<TWeakObjectPtr<UPackage>> TouchedPackages;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	TWeakPtr<SNotificationItem> Notification;
+};
@@ -0,0 +1,58 @@
+// AbilityEditorAttributeIndex.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * AttributeSet 属性索引：属性字符串 -> FGameplayAttribute
+ * - 首次查询时遍历 UAttributeSet 的全部派生类构建，之后每次查询为一次哈希查找
+ * - 键不区分大小写，支持 "ClassName.Property" 与 "/Script/Module.ClassName:Property" 两种格式
+ * - 只收录 FGameplayAttributeData 类型的属性，跳过抽象类
+ * - 模块加载与热重载后失效，下次查询时重建
+ * - 线程安全（读写锁）
+ */
+class ABILITYEDITORHELPER_API FAbilityEditorAttributeIndex : public FNoncopyable
+{
+public:
+	static FAbilityEditorAttributeIndex& Get();
+
+	/** 按完整属性字符串查找（"ClassName.Property" 或 "/Script/Module.ClassName:Property"） */
+	bool Find(const FString& AttributeString, FGameplayAttribute& OutAttribute);
+
+	/** 按类名与属性名查找；类名可省略 U 前缀 */
+	bool Find(const FString& ClassName, const FString& PropertyName, FGameplayAttribute& OutAttribute);
+
+	/** 是否存在该名称的非抽象 AttributeSet 类（用于区分"类不存在"与"属性不存在"） */
+	bool HasAttributeSetClass(const FString& ClassName);
+
+	/** 使索引失效，下次查询时重建 */
+	void Invalidate();
+
+	/** 注册模块加载与热重载事件（模块启动时调用） */
+	void RegisterInvalidationDelegates();
+
+	/** 注销事件（模块关闭时调用） */
+	void UnregisterInvalidationDelegates();
+
+private:
+	/** 确保索引已构建（持有读锁时不可调用） */
+	void EnsureBuilt();
+
+	/** 以小写类名查找；与旧逻辑一致，同时尝试补 U 前缀的类名 */
+	const FGameplayAttribute* FindByClassKeyLocked(const FString& LowerClassName, const FString& LowerPropertyName) const;
+
+	FRWLock Lock;
+	bool bBuilt = false;
+
+	/** 小写 "classname.property" 与 "/script/module.classname:property" -> 属性 */
+	TMap<FString, FGameplayAttribute> Attributes;
+
+	/** 小写类名集合 */
+	TSet<FString> ClassNames;
+
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle ModulesChangedHandle;
+};
@@ -0,0 +1,67 @@
+// AbilityEditorBulkImportScope.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UPackage;
+class ITransaction;
+
+/**
+ * 批量导入作用域（RAII）
+ * 作用域内的 AssetCreated 与 MarkPackageDirty 不会立即通知资产注册表 / Content Browser，
+ * 而是去重后在最外层作用域结束时统一刷新一次，避免数千个资产逐个触发监听者刷新
+ * - 可嵌套：只有最外层作用域负责刷新
+ * - 按 Settings 的 BulkImportUndoMode，最外层作用域期间可停止记录撤销，结束后可清空撤销缓冲区
+ * - 最外层作用域即一次导入会话：期间按路径加载的类/对象会被缓存，结束时清空
+ * - 作用域外调用 AssetCreated / MarkPackageDirty 时行为与直接调用引擎接口一致
+ * - 仅在游戏线程使用
+ */
+class ABILITYEDITORHELPER_API FAbilityEditorBulkImportScope : public FNoncopyable
+{
+public:
+	FAbilityEditorBulkImportScope();
+	~FAbilityEditorBulkImportScope();
+
+	/** 当前是否处于批量导入作用域内 */
+	static bool IsActive() { return RootScope != nullptr; }
+
+	/** 新建资产：作用域内延迟到结束时通知资产注册表，否则立即通知 */
+	static void AssetCreated(UObject* Asset);
+
+	/** 标记对象所在包为脏：作用域内延迟并去重，否则立即标记 */
+	static void MarkPackageDirty(UObject* Object);
+
+	/** 是否为最外层作用域（负责刷新） */
+	bool IsRootScope() const { return RootScope == this; }
+
+	/** 作用域内新建或被标记为脏的包（保持首次出现顺序） */
+	TArray<UPackage*> GetTouchedPackages() const;
+
+	/** 立即刷新已累积的通知（嵌套作用域中调用时刷新最外层作用域） */
+	void Flush();
+
+	/**
+	 * 刷新通知后，一次性保存作用域内新建或实际变化的包（只对最外层作用域有效）
+	 * 启用源码管理时先静默签出（不弹出任何对话框），再使用 SAVE_Async 异步写文件，全部提交后统一等待写入完成，并输出每个包的耗时
+	 * @return 全部保存成功返回 true；有包保存失败（如未能签出）时返回 false
+	 */
+	bool SaveTouchedPackages();
+
+private:
+	static FAbilityEditorBulkImportScope* RootScope;
+
+	/** 进入作用域前的 GUndo（停止记录撤销时恢复用） */
+	ITransaction* SavedUndo = nullptr;
+	bool bSuppressingUndo = false;
+	bool bResetUndoBufferOnExit = false;
+
+	TArray<TWeakObjectPtr<UObject>> PendingCreatedAssets;
+	TArray<TWeakObjectPtr<UPackage>> PendingDirtyPackages;
+	TSet<TWeakObjectPtr<UPackage>> PendingDirtyPackageSet;
+
+	/** 已刷新的包，供 GetTouchedPackages 使用 */
+	TArray<TWeakObjectPtr<UPackage>> TouchedPackages;
+	TSet<TWeakObjectPtr<UPackage>> TouchedPackageSet;
+};
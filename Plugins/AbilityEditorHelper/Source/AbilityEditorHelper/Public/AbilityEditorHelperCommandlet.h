@@ -0,0 +1,116 @@
+// AbilityEditorHelperCommandlet.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AbilityEditorHelperCommandlet.generated.h"
+
+/** 命令行单个步骤的执行结果 */
+USTRUCT()
+struct FAbilityEditorCommandletStepReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Name;
+
+	UPROPERTY()
+	bool bSuccess = false;
+
+	UPROPERTY()
+	double Seconds = 0.0;
+};
+
+/** 分片工作进程的报告（工作进程写入，协调进程补充退出码与日志统计后合并） */
+USTRUCT()
+struct FAbilityEditorShardReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 ShardIndex = 0;
+
+	UPROPERTY()
+	int32 ShardCount = 1;
+
+	UPROPERTY()
+	bool bSuccess = false;
+
+	UPROPERTY()
+	double Seconds = 0.0;
+
+	UPROPERTY()
+	int32 ExitCode = -1;
+
+	UPROPERTY()
+	int32 WarningCount = 0;
+
+	UPROPERTY()
+	int32 ErrorCount = 0;
+
+	UPROPERTY()
+	FString LogFile;
+
+	UPROPERTY()
+	TArray<FAbilityEditorCommandletStepReport> Steps;
+};
+
+/** 协调进程合并后的分片生成报告，写入 Saved/AbilityEditorHelper/Reports */
+USTRUCT()
+struct FAbilityEditorShardedRunReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Target;
+
+	UPROPERTY()
+	int32 ShardCount = 1;
+
+	UPROPERTY()
+	bool bSuccess = false;
+
+	UPROPERTY()
+	double Seconds = 0.0;
+
+	UPROPERTY()
+	TArray<FAbilityEditorShardReport> Shards;
+};
+
+/**
+ * 无界面的导入命令行（供 CI / 构建机使用），按以下顺序执行所选步骤：
+ * Schema 导出 -> GE JSON 导入 -> GA JSON 导入 -> GE 批量生成 -> GA 批量生成 -> 保存
+ *
+ * 用法：
+ * UnrealEditor-Cmd <Project>.uproject -run=AbilityEditorHelper [开关] -unattended -nullrhi
+ *
+ * 开关：
+ * -Schemas             根据 Settings 导出全部 Schema（-ClearSchemas 先清空 Schema 目录）
+ * -ImportGE=<文件名>    增量导入 GE：.json 读取 JsonPath 下的 JSON（同 ImportAndUpdateGameplayEffectsFromJson），
+ *                      .xlsx/.xlsm/.csv 直接读取 ExcelPath 下的工作簿（同 ImportAndUpdateGameplayEffectsFromExcel）
+ * -ImportGA=<文件名>    增量导入 GA，规则同 -ImportGE
+ * -GenerateGE          按 DataTable 批量生成 GE（同 CreateOrUpdateGameplayEffectsFromSettings）
+ * -GenerateGA          按 DataTable 批量生成 GA（同 CreateOrUpdateGameplayAbilitiesFromSettings）
+ *                      同时指定 -GenerateGE 与 -GenerateGA 时按依赖顺序一次生成（同 CreateOrUpdateGameplayEffectsAndAbilitiesFromSettings）
+ * -Clear               导入/生成前清理输出目录中不在 DataTable 的资产
+ * -Force               忽略输入指纹，强制全量生成
+ * -NoSave              不保存（默认会一次性保存本次新建或变化的包）
+ * -Shards=<N>          协调模式：GE/GA 批量生成按行名哈希拆成 N 个分片，启动 N 个工作进程并行生成并各自保存，
+ *                      结束后合并日志中的警告/错误与各分片报告（Schema 导出与 JSON 导入仍在本进程执行）
+ *
+ * 工作进程参数（由协调进程传入，无需手动指定）：
+ * -ShardCount=<N> -ShardIndex=<i> -ShardReport=<报告路径>
+ *
+ * 任一步骤失败时停止后续步骤并返回非零退出码
+ */
+UCLASS()
+class ABILITYEDITORHELPER_API UAbilityEditorHelperCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAbilityEditorHelperCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
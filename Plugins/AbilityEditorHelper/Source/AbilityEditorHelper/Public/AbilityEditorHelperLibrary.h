@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "AbilityEditorTypes.h"
+#include "AbilityEditorPropertyHandles.h"
 #include "GameplayEffect.h"
 #include "GameplayEffectComponent.h"
 #include "AbilityEditorHelperLibrary.generated.h"
@@ -12,6 +13,13 @@
 class UBlueprint;
 class UAbilityEditorHelperSettings;
 
+/** 内置行类型（供命令行分片协调使用；行类型名见 FAbilityEditorRowAssetTypeRegistry::GetBuiltInTypeName） */
+enum class EAbilityEditorGenerationTarget : uint8
+{
+	GameplayEffect,
+	GameplayAbility,
+};
+
 /**
  * 从 GameplayEffect 中移除指定类型的 GEComponent（模板函数）
  * @param GE        目标 GameplayEffect
@@ -25,14 +33,10 @@ bool RemoveGEComponent(UGameplayEffect* GE)
 		return false;
 	}
 
-	// 通过反射获取 GEComponents 数组
-	FArrayProperty* GEComponentsProp = CastField<FArrayProperty>(
-		UGameplayEffect::StaticClass()->FindPropertyByName(TEXT("GEComponents"))
-	);
-
+	// 通过反射获取 GEComponents 数组（句柄未解析时已在模块启动时报告）
+	FArrayProperty* GEComponentsProp = FAbilityEditorPropertyHandles::Get().GEComponents;
 	if (!GEComponentsProp)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[AbilityEditorHelper] 无法通过反射找到 GEComponents 属性"));
 		return false;
 	}
 
@@ -57,6 +61,31 @@ bool RemoveGEComponent(UGameplayEffect* GE)
 	return false;
 }
 
+/**
+ * 生成资产相对 DataTable 的状态（仅依据资产注册表中的来源标签与配置印记，不加载资产）
+ */
+USTRUCT(BlueprintType)
+struct FAbilityEditorGenerationReport
+{
+	GENERATED_BODY()
+
+	/** 配置印记与当前行一致，批量生成时将跳过的资产 */
+	UPROPERTY(BlueprintReadOnly, Category = "AbilityEditorHelper")
+	TArray<FString> UpToDateAssets;
+
+	/** 行存在但印记不一致（或没有印记），批量生成时将重新应用配置的资产 */
+	UPROPERTY(BlueprintReadOnly, Category = "AbilityEditorHelper")
+	TArray<FString> StaleAssets;
+
+	/** 尚无对应资产、批量生成时将创建的行 */
+	UPROPERTY(BlueprintReadOnly, Category = "AbilityEditorHelper")
+	TArray<FName> MissingRows;
+
+	/** 已不对应 DataTable 中任何行的资产（清理目录时将被删除） */
+	UPROPERTY(BlueprintReadOnly, Category = "AbilityEditorHelper")
+	TArray<FString> OrphanedAssets;
+};
+
 /**
  * 
  */
@@ -106,11 +135,14 @@ public:
 
 	/**
 	 * 基于 UAbilityEditorHelperSettings 中的 DataTable 与 GameplayEffectPath，批量创建/更新 GameplayEffect。
-	 * 不返回创建的对象或数量，处理结果通过日志输出。
+	 * 不返回创建的对象或数量，逐行处理结果通过日志输出。
+	 * 输入指纹（DataTable 内容、Settings、插件版本、Schema Hash）与上次成功运行一致时直接返回。
 	 * @param bClearGameplayEffectFolderFirst  在导入前是否先清理 GameplayEffectPath 路径下（含子目录）中不在 DataTable 的 GE 资产
+	 * @param bForceFullUpdate                 忽略输入指纹，强制重新生成全部 GE
+	 * @return                                 全部成功（或输入未变化）返回 true
 	 */
-	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|GameplayEffect", meta=(DisplayName="Create Or Update GameplayEffects From Settings", Keywords="GameplayEffect Import Update From Settings", CPP_Default_bClearGameplayEffectFolderFirst="false"))
-	static void CreateOrUpdateGameplayEffectsFromSettings(bool bClearGameplayEffectFolderFirst = false);
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|GameplayEffect", meta=(DisplayName="Create Or Update GameplayEffects From Settings", Keywords="GameplayEffect Import Update From Settings", CPP_Default_bClearGameplayEffectFolderFirst="false", CPP_Default_bForceFullUpdate="false"))
+	static bool CreateOrUpdateGameplayEffectsFromSettings(bool bClearGameplayEffectFolderFirst = false, bool bForceFullUpdate = false);
 
 	/** 
 	 * 将任意 UStruct 的描述导出为 Schema(JSON)。输入 StructPath 完整路径（如 /Script/Module.StructName）。
@@ -145,19 +177,21 @@ public:
 
 	/**
 	 * 从指定 JSON 文件导入数据到目标 DataTable。
+	 * 文件以内存映射方式读取并直接按 UTF-8 流式解析；全部行读取成功后才写入 DataTable
 	 * @param TargetDataTable      目标数据表
-	 * @param JsonFileName         JSON 文件名（将与 UAbilityEditorHelperSettings::JsonPath 拼接成完整路径）
-	 * @param bClearBeforeImport   导入前是否清空现有行
-	 * @param OutImportedRowCount  成功导入的行数（由引擎返回）
+	 * @param JsonFileName         JSON 文件名（将与 UAbilityEditorHelperSettings::JsonPath 拼接成完整路径；.aebin 为 Python 工具导出的二进制行文件）
+	 * @param bClearBeforeImport   导入前是否清空现有行（否则同名行被覆盖、其余行保留）
+	 * @param OutImportedRowCount  成功导入的行数（缺少 Name 或无法反序列化的行会跳过并记录警告）
 	 * @param OutError             失败时的错误信息
-	 * @return                     是否导入成功（依据引擎返回值>=0判定）
+	 * @return                     文件读取与解析是否成功
 	 */
 	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|DataTable", meta=(DisplayName="Import DataTable From JSON File", Keywords="DataTable Import JSON"))
 	static bool ImportDataTableFromJsonFile(UDataTable* TargetDataTable, const FString& JsonFileName, bool bClearBeforeImport, int32& OutImportedRowCount, FString& OutError);
 
 	/**
 	 * 将简化的属性字符串解析为 FGameplayAttribute
-	 * @param AttributeString  简化格式字符串（如 "TestAttributeSet.TestPropertyOne"）
+	 * 通过 FAbilityEditorAttributeIndex 查找（首次调用时构建索引，之后为哈希查找）
+	 * @param AttributeString  简化格式字符串（如 "TestAttributeSet.TestPropertyOne"），也支持 "/Script/Module.ClassName:PropertyName"
 	 * @param OutAttribute     输出的 FGameplayAttribute
 	 * @return                 是否解析成功
 	 */
@@ -172,7 +206,7 @@ public:
 	 * 3. 只对变化的行更新 DataTable
 	 * 4. 只对变化的行创建/更新 GameplayEffect 资产
 	 *
-	 * @param JsonFileName             JSON 文件名（相对于 Settings::JsonPath）
+	 * @param JsonFileName             JSON 文件名（相对于 Settings::JsonPath；.aebin 为 Python 工具导出的二进制行文件）
 	 * @param bClearGameplayEffectFolderFirst  是否先清理不在 DataTable 中的 GE 资产
 	 * @param OutUpdatedRowNames       被更新的行名列表
 	 * @param OutError                 错误信息
@@ -181,6 +215,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|GameplayEffect", meta=(DisplayName="Import And Update GameplayEffects From JSON"))
 	static bool ImportAndUpdateGameplayEffectsFromJson(const FString& JsonFileName, bool bClearGameplayEffectFolderFirst, TArray<FName>& OutUpdatedRowNames);
 
+	/**
+	 * 直接从 Excel 工作簿（或 CSV 目录）导入数据并更新 GameplayEffects（增量更新）
+	 * 按与 Python 工具相同的表格约定原生读取，不生成中间 JSON 文件；比较、清单与资产生成流程同 ImportAndUpdateGameplayEffectsFromJson
+	 * @param ExcelFileName                    Excel 文件名（相对于 Settings::ExcelPath，可不带 .xlsx 后缀；.csv 文件或目录表示 CSV 目录布局）
+	 * @param bClearGameplayEffectFolderFirst  是否先清理不在 DataTable 中的 GE 资产
+	 * @param OutUpdatedRowNames               被更新的行名列表
+	 * @return                                 是否成功
+	 */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|GameplayEffect", meta=(DisplayName="Import And Update GameplayEffects From Excel"))
+	static bool ImportAndUpdateGameplayEffectsFromExcel(const FString& ExcelFileName, bool bClearGameplayEffectFolderFirst, TArray<FName>& OutUpdatedRowNames);
+
 	// ===========================================
 	// GameplayAbility 相关函数
 	// ===========================================
@@ -196,15 +241,18 @@ public:
 
 	/**
 	 * 基于 UAbilityEditorHelperSettings 中的 DataTable 与 GameplayAbilityPath，批量创建/更新 GameplayAbility。
-	 * 不返回创建的对象或数量，处理结果通过日志输出。
+	 * 不返回创建的对象或数量，逐行处理结果通过日志输出。
+	 * 输入指纹（DataTable 内容、Settings、插件版本、Schema Hash）与上次成功运行一致时直接返回。
 	 * @param bClearGameplayAbilityFolderFirst  在导入前是否先清理 GameplayAbilityPath 路径下不在 DataTable 的 GA 资产
+	 * @param bForceFullUpdate                  忽略输入指纹，强制重新生成全部 GA
+	 * @return                                  全部成功（或输入未变化）返回 true
 	 */
 	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|GameplayAbility", meta=(DisplayName="Create Or Update GameplayAbilities From Settings"))
-	static void CreateOrUpdateGameplayAbilitiesFromSettings(bool bClearGameplayAbilityFolderFirst = false);
+	static bool CreateOrUpdateGameplayAbilitiesFromSettings(bool bClearGameplayAbilityFolderFirst = false, bool bForceFullUpdate = false);
 
 	/**
 	 * 从 JSON 文件导入数据并更新 GameplayAbilities（增量更新）
-	 * @param JsonFileName                      JSON 文件名（相对于 Settings::JsonPath）
+	 * @param JsonFileName                      JSON 文件名（相对于 Settings::JsonPath；.aebin 为 Python 工具导出的二进制行文件）
 	 * @param bClearGameplayAbilityFolderFirst  是否先清理不在 DataTable 中的 GA 资产
 	 * @param OutUpdatedRowNames                被更新的行名列表
 	 * @return                                  是否成功
@@ -212,13 +260,95 @@ public:
 	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|GameplayAbility", meta=(DisplayName="Import And Update GameplayAbilities From JSON"))
 	static bool ImportAndUpdateGameplayAbilitiesFromJson(const FString& JsonFileName, bool bClearGameplayAbilityFolderFirst, TArray<FName>& OutUpdatedRowNames);
 
-private:
-	/** 获取 GA 设置和 DataTable */
-	static bool GetGASettingsAndDataTable(const UAbilityEditorHelperSettings*& OutSettings, UDataTable*& OutDataTable);
+	/**
+	 * 直接从 Excel 工作簿（或 CSV 目录）导入数据并更新 GameplayAbilities（增量更新），不生成中间 JSON 文件
+	 * @param ExcelFileName                     Excel 文件名（相对于 Settings::ExcelPath，可不带 .xlsx 后缀）
+	 * @param bClearGameplayAbilityFolderFirst  是否先清理不在 DataTable 中的 GA 资产
+	 * @param OutUpdatedRowNames                被更新的行名列表
+	 * @return                                  是否成功
+	 */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|GameplayAbility", meta=(DisplayName="Import And Update GameplayAbilities From Excel"))
+	static bool ImportAndUpdateGameplayAbilitiesFromExcel(const FString& ExcelFileName, bool bClearGameplayAbilityFolderFirst, TArray<FName>& OutUpdatedRowNames);
+
+	/**
+	 * 基于 Settings 中的 GE 与 GA DataTable 一次性创建/更新全部 GameplayEffect 与 GameplayAbility。
+	 * 两张表的行按引用关系（ParentClass、GrantedAbilityClasses、CostGameplayEffectClass、CooldownGameplayEffectClass）
+	 * 构成依赖图并拓扑排序，被引用的资产先生成；引用本次生成的资产时直接使用内存中的结果，不再按路径加载。
+	 * 首次导入时一次运行即可得到完整的资产集合；存在循环引用时，循环中的资产会在最后生成两遍。
+	 * @param bClearFoldersFirst  在导入前是否先清理 GE/GA 路径下不在 DataTable 的资产
+	 * @param bForceFullUpdate    忽略输入指纹，强制重新生成全部 GE 与 GA
+	 * @return                    全部成功（或输入未变化）返回 true
+	 */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|Import", meta=(DisplayName="Create Or Update GameplayEffects And Abilities From Settings", CPP_Default_bClearFoldersFirst="false", CPP_Default_bForceFullUpdate="false"))
+	static bool CreateOrUpdateGameplayEffectsAndAbilitiesFromSettings(bool bClearFoldersFirst = false, bool bForceFullUpdate = false);
+
+	// ===========================================
+	// 按行类型导入（内置的 GameplayEffect / GameplayAbility 与项目注册的行类型，见 FAbilityEditorRowAssetTypeRegistry）
+	// ===========================================
+
+	/**
+	 * 按行类型批量创建/更新资产；GE / GA 的 CreateOrUpdate...FromSettings 即 RowType 为 "GameplayEffect" / "GameplayAbility" 的调用
+	 * @param RowType             已注册的行类型名称
+	 * @param bClearFolderFirst   在导入前是否先清理输出目录下不在 DataTable 的资产
+	 * @param bForceFullUpdate    忽略输入指纹，强制重新生成全部资产
+	 * @return                    全部成功（或输入未变化）返回 true；行类型未注册时返回 false
+	 */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|Import", meta=(DisplayName="Create Or Update Row Type Assets", CPP_Default_bClearFolderFirst="false", CPP_Default_bForceFullUpdate="false"))
+	static bool CreateOrUpdateRowTypeAssets(FName RowType, bool bClearFolderFirst = false, bool bForceFullUpdate = false);
+
+	/**
+	 * 多个行类型按引用关系统一生成（行类型的 GatherReferences 提供引用），流程同 CreateOrUpdateGameplayEffectsAndAbilitiesFromSettings
+	 * @param RowTypes  已注册的行类型名称；GE + GA 即 CreateOrUpdateGameplayEffectsAndAbilitiesFromSettings
+	 */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|Import", meta=(DisplayName="Create Or Update Row Types Assets", CPP_Default_bClearFoldersFirst="false", CPP_Default_bForceFullUpdate="false"))
+	static bool CreateOrUpdateRowTypesAssets(const TArray<FName>& RowTypes, bool bClearFoldersFirst = false, bool bForceFullUpdate = false);
+
+	/** 按行类型从 JSON / .aebin 文件增量导入，流程同 ImportAndUpdateGameplayEffectsFromJson */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|Import", meta=(DisplayName="Import And Update Row Type From JSON"))
+	static bool ImportAndUpdateRowTypeFromJson(FName RowType, const FString& JsonFileName, bool bClearFolderFirst, TArray<FName>& OutUpdatedRowNames);
+
+	/** 按行类型从 Excel 工作簿（或 CSV 目录）增量导入，流程同 ImportAndUpdateGameplayEffectsFromExcel */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|Import", meta=(DisplayName="Import And Update Row Type From Excel"))
+	static bool ImportAndUpdateRowTypeFromExcel(FName RowType, const FString& ExcelFileName, bool bClearFolderFirst, TArray<FName>& OutUpdatedRowNames);
+
+	/** 全部已注册的行类型名称（按注册顺序） */
+	UFUNCTION(BlueprintPure, Category="AbilityEditorHelper|Import")
+	static TArray<FName> GetRegisteredRowTypes();
+
+	// ===========================================
+	// 多进程分片生成（仅 C++，供命令行协调进程使用）
+	// ===========================================
+
+	/**
+	 * 批量生成的输入指纹是否与上次成功生成一致
+	 * 协调进程据此判断是否需要启动工作进程
+	 */
+	static bool IsBatchGenerationUpToDate(EAbilityEditorGenerationTarget Target, bool bClearFolderFirst);
+
+	/**
+	 * 将当前输入指纹记录为已成功生成
+	 * 各分片工作进程不写清单，由协调进程在全部分片成功后调用；会先同步扫描输出目录，使其他进程新建的资产计入指纹
+	 * @return 写入清单成功返回 true
+	 */
+	static bool SaveBatchGenerationFingerprint(EAbilityEditorGenerationTarget Target, bool bClearFolderFirst);
+
+	// ===========================================
+	// 生成状态查询（仅读取资产注册表，不加载资产）
+	// ===========================================
+
+	/**
+	 * 对比 GE DataTable 与输出目录：哪些资产已是最新、哪些会被更新或创建、哪些已成孤儿
+	 * 依据生成时写入的来源标签（DataTable、行名）与配置印记，未保存的修改以内存中的资产为准
+	 * @return  Settings 或 DataTable 无效时返回 false
+	 */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|GameplayEffect", meta=(DisplayName="Get GameplayEffect Generation Report"))
+	static bool GetGameplayEffectGenerationReport(FAbilityEditorGenerationReport& OutReport);
 
-	/** 获取 GA 基础路径 */
-	static FString GetGameplayAbilityBasePath(const UAbilityEditorHelperSettings* Settings);
+	/** 同 GetGameplayEffectGenerationReport，针对 GA DataTable */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|GameplayAbility", meta=(DisplayName="Get GameplayAbility Generation Report"))
+	static bool GetGameplayAbilityGenerationReport(FAbilityEditorGenerationReport& OutReport);
 
-	/** 清理 GA 文件夹中不在 DataTable 中的资产 */
-	static void CleanupGameplayAbilityFolder(const FString& BasePath, const UDataTable* DataTable);
+	/** 按行类型查询生成状态 */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|Import", meta=(DisplayName="Get Row Type Generation Report"))
+	static bool GetGenerationReport(FName RowType, FAbilityEditorGenerationReport& OutReport);
 };
@@ -12,6 +12,22 @@ class UGameplayAbility;
 class UDataTable;
 class UEditorUtilityWidgetBlueprint;
 
+/**
+ * 批量导入期间的撤销（Undo）记录方式
+ */
+UENUM()
+enum class EAbilityEditorBulkUndoMode : uint8
+{
+	/** 与普通编辑一致：每个对象的修改都记录到撤销缓冲区 */
+	Record,
+
+	/** 批量导入期间不记录撤销，内存与耗时不随行数增长 */
+	Suppress,
+
+	/** 不记录撤销，并在导入结束后清空撤销缓冲区（避免旧记录引用已被重建或删除的资产） */
+	SuppressAndResetBuffer,
+};
+
 /**
  *
  */
@@ -23,6 +39,13 @@ class ABILITYEDITORHELPER_API UAbilityEditorHelperSettings : public UDeveloperSe
 public:
 	UAbilityEditorHelperSettings();
 
+	/**
+	 * 影响生成结果的设置的内容哈希（批量生成输入指纹与配置印记使用）
+	 * 只包含生成类、DataTable、输出目录与配置结构体类型；数据路径、导入行为、保存、撤销与监视等设置变化不会使已生成的资产失效
+	 * 新增影响生成结果的设置时需同步加入 AbilityEditorHelperSettings.cpp 中的属性列表
+	 */
+	uint64 GetGenerationSettingsHash() const;
+
 	// === GameplayEffect 配置 ===
 
 	/** 创建 GameplayEffect 时默认使用的类 */
@@ -83,6 +106,53 @@ public:
 	UPROPERTY(Config, BlueprintReadOnly, EditAnywhere, Category = "DataPath")
 	FString SchemaPath;
 
+	// === 批量导入配置 ===
+
+	/**
+	 * 批量创建/导入 GE、GA 后，是否自动保存本次新建或实际发生变化的包
+	 * 启用源码管理时先自动签出（不弹出对话框），再使用引擎的异步写文件路径保存，并在日志中输出每个包的耗时
+	 * 有包保存失败时本次导入视为失败，不记录输入指纹与增量清单
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "BulkImport")
+	bool bSaveChangedPackagesAfterImport = false;
+
+	/**
+	 * 批量创建/导入 GE、GA 期间的撤销记录方式
+	 * 默认与普通编辑一致；导入行数很多、撤销缓冲区占用明显时可改为不记录
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "BulkImport")
+	EAbilityEditorBulkUndoMode BulkImportUndoMode = EAbilityEditorBulkUndoMode::Record;
+
+	/**
+	 * 异步导入（UAbilityEditorAsyncImport）每帧用于生成资产的时间预算（毫秒）
+	 * 每帧至少处理一行；预算越大导入越快，编辑器响应越慢
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "BulkImport", meta = (ClampMin = "1", UIMin = "1", UIMax = "100", Units = "ms"))
+	float AsyncImportFrameBudgetMs = 10.f;
+
+	/**
+	 * 增量导入时同步删除：数据源（JSON / .aebin / Excel）中已不存在的行会从 DataTable 移除，并删除由该行生成的 GE/GA 资产
+	 * 只处理上次增量导入的清单中记录过的行：在编辑器中手动添加到 DataTable 的行、以及清单缺失或失效（首次导入、行结构变化）时都不会删除
+	 * 仍被其他资产引用的生成资产保留并输出警告；不扫描输出目录；导入被取消或数据读取失败时不删除任何内容
+	 * 默认开启；关闭后数据源中删除的行会一直保留在 DataTable 中，生成的资产也不会删除
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "BulkImport")
+	bool bDeleteRowsRemovedFromSource = true;
+
+	// === 监视模式配置 ===
+
+	/**
+	 * 监视 ExcelPath 与 JsonPath 目录（仅编辑器）：
+	 * GameplayEffectExcelName / GameplayAbilityExcelName 对应的 Excel 变化后直接读取工作簿增量导入，
+	 * JSON 变化后自动对该表执行异步增量导入
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "WatchMode")
+	bool bWatchSourceFiles = false;
+
+	/** 文件最后一次变化后等待多久再处理（秒），期间同一张表的连续变化合并为一次 */
+	UPROPERTY(Config, EditAnywhere, Category = "WatchMode", meta = (EditCondition = "bWatchSourceFiles", ClampMin = "0.1", UIMin = "0.1", UIMax = "10", Units = "s"))
+	float WatchDebounceSeconds = 1.f;
+
 	// === Schema 配置 ===
 
 	// === EditorWidget 配置 ===
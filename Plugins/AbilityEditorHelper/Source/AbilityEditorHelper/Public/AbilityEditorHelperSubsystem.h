@@ -6,10 +6,13 @@
 #include "AbilityEditorHelperSettings.h"
 #include "Engine/DataTable.h"
 #include "EditorSubsystem.h"
+#include "Containers/Ticker.h"
 #include "AbilityEditorHelperSubsystem.generated.h"
 
 class UGameplayEffect;
 class UGameplayAbility;
+struct FFileChangeData;
+struct FPropertyChangedEvent;
 
 /**
  * 后处理委托：在 CreateOrImportGameplayEffect 完成基础配置后广播
@@ -36,7 +39,7 @@ class ABILITYEDITORHELPER_API UAbilityEditorHelperSubsystem : public UEditorSubs
 	GENERATED_BODY()
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
-	virtual void Deinitialize() override { CachedGameplayEffectDataTable = nullptr; CachedGameplayAbilityDataTable = nullptr; Super::Deinitialize(); }
+	virtual void Deinitialize() override;
 
 	/** 获取缓存的 DataTable */
 	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|Subsystem")
@@ -72,7 +75,59 @@ public:
 	/** 广播 GA 后处理委托（供 AbilityEditorHelperLibrary 内部调用） */
 	void BroadcastPostProcessGameplayAbility(const FTableRowBase* Config, UGameplayAbility* GA);
 
+	/**
+	 * 按 Settings 重新注册监视模式的目录监视（bWatchSourceFiles 关闭时只注销）
+	 * 在 Settings 中修改监视相关配置后会自动调用
+	 */
+	UFUNCTION(BlueprintCallable, Category="AbilityEditorHelper|Subsystem")
+	void RefreshSourceFileWatchers();
+
+	/** 监视模式是否正在运行 */
+	UFUNCTION(BlueprintPure, Category="AbilityEditorHelper|Subsystem")
+	bool IsWatchingSourceFiles() const { return WatchedDirectories.Num() > 0; }
+
 private:
+	/** 一张表等待处理的文件变化（同一张表在防抖时间内的多次变化合并为一次） */
+	struct FPendingSourceChange
+	{
+		/** 最近一次变化的时间（FPlatformTime::Seconds） */
+		double LastChangeTime = 0.0;
+		/** Excel 变化：直接从工作簿增量导入 */
+		bool bExcelChanged = false;
+		/** 最近一次变化的 Excel 文件（.xlsx/.xlsm/.csv 完整路径） */
+		FString ChangedExcelFile;
+		/** JSON 变化：需要增量导入 */
+		bool bJsonChanged = false;
+		/** 最近一次变化的 JSON 文件（.json/.aebin 完整路径） */
+		FString ChangedJsonFile;
+
+		bool IsPending() const { return bExcelChanged || bJsonChanged; }
+	};
+
+	/** 一个被监视的目录 */
+	struct FWatchedDirectory
+	{
+		FString Directory;
+		FDelegateHandle Handle;
+	};
+
+	void StopWatchingSourceFiles();
+
+	/** 目录监视回调（游戏线程）：把变化归到对应的表并重置其防抖计时 */
+	void OnSourceDirectoryChanged(const TArray<FFileChangeData>& Changes);
+
+	/** 防抖到期的表：Excel 变化直接从工作簿、JSON 变化从 JSON 启动异步增量导入 */
+	bool TickPendingSourceChanges(float DeltaTime);
+
+	void OnSettingsChanged(UObject* SettingsObject, FPropertyChangedEvent& PropertyChangedEvent);
+
+	/** 按 EAbilityEditorGenerationTarget 索引（GE、GA） */
+	FPendingSourceChange PendingSourceChanges[2];
+
+	TArray<FWatchedDirectory> WatchedDirectories;
+	FTSTicker::FDelegateHandle PendingSourceTickerHandle;
+	FDelegateHandle SettingsChangedHandle;
+
 	/** 缓存的 GE 配置 DataTable（编辑器运行期内存缓存） */
 	UPROPERTY(Transient)
 	TObjectPtr<UDataTable> CachedGameplayEffectDataTable = nullptr;
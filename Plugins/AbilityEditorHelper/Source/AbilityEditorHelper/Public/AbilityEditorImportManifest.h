@@ -0,0 +1,99 @@
+// AbilityEditorImportManifest.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilityEditorImportManifest.generated.h"
+
+class UDataTable;
+
+/**
+ * 清单中的单行记录（64 位哈希以 16 位十六进制字符串保存，避免 JSON 数字精度丢失）
+ */
+USTRUCT()
+struct FAbilityEditorManifestRow
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName RowName;
+
+	/** 该行 JSON 源数据（Token 序列）的哈希 */
+	UPROPERTY()
+	FString SourceHash;
+
+	/** 该行配置结构体的内容哈希（FAbilityEditorStructHash） */
+	UPROPERTY()
+	FString ConfigHash;
+};
+
+/**
+ * 增量导入清单：每个 DataTable 一份，保存在 Saved/AbilityEditorHelper/Manifests 下
+ * 记录上次成功导入时每行的源数据哈希与配置哈希，以及行结构的 Schema Hash
+ * 重新导入时源数据哈希未变化、且 DataTable 中该行的内容哈希仍与记录的配置哈希一致的行直接跳过，无需绑定结构体
+ * 清单只表示"上次导入写入了什么"，不依赖 DataTable 是否已保存：未保存的修改丢失后，行内容与配置哈希不符，该行会重新导入
+ */
+USTRUCT()
+struct ABILITYEDITORHELPER_API FAbilityEditorImportManifest
+{
+	GENERATED_BODY()
+
+	/** 清单格式版本，结构变化时递增以使旧清单失效 */
+	static constexpr int32 CurrentVersion = 1;
+
+	UPROPERTY()
+	int32 Version = 0;
+
+	UPROPERTY()
+	FString DataTablePath;
+
+	UPROPERTY()
+	FString RowStructPath;
+
+	/** 行结构的 Schema Hash（与 FExcelSchema::Hash 相同算法） */
+	UPROPERTY()
+	FString SchemaHash;
+
+	/**
+	 * 上次 CreateOrUpdate*FromSettings 全部成功时的输入指纹
+	 * 由 DataTable 内容、影响生成结果的设置、插件版本、Schema Hash 与输出目录资产数量共同计算
+	 */
+	UPROPERTY()
+	FString GenerationFingerprint;
+
+	UPROPERTY()
+	TArray<FAbilityEditorManifestRow> Rows;
+
+	/** 清单文件路径：Saved/AbilityEditorHelper/Manifests/<DataTable 路径>.json */
+	static FString GetManifestFilePath(const UDataTable* DataTable);
+
+	/**
+	 * 读取 DataTable 对应的清单
+	 * 文件不存在、版本不符或 RowStructPath/SchemaHash 与当前不一致时返回 false（视为无清单）
+	 */
+	static bool Load(const UDataTable* DataTable, const FString& InSchemaHash, FAbilityEditorImportManifest& OutManifest);
+
+	/** 删除 DataTable 对应的清单（DataTable 被其他途径整体改写时调用） */
+	static void Delete(const UDataTable* DataTable);
+
+	/** 初始化清单头（版本、DataTable 与行结构信息），清空行记录 */
+	void ResetHeader(const UDataTable* DataTable, const FString& InSchemaHash);
+
+	/** 写入清单文件 */
+	bool Save(const UDataTable* DataTable) const;
+
+	/** 按行名查找记录 */
+	const FAbilityEditorManifestRow* FindRow(FName RowName) const;
+
+	/** 查找或追加记录（保持首次出现的顺序） */
+	FAbilityEditorManifestRow& FindOrAddRow(FName RowName);
+
+	static FString HashToString(uint64 Hash);
+	static uint64 StringToHash(const FString& HashString);
+
+private:
+	void RebuildRowIndex();
+
+	/** 行名 -> Rows 下标（不序列化） */
+	TMap<FName, int32> RowIndex;
+};
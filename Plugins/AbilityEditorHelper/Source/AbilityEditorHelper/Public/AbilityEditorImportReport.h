@@ -0,0 +1,77 @@
+// AbilityEditorImportReport.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilityEditorImportReport.generated.h"
+
+class UDataTable;
+
+/**
+ * 基于反射的逐字段比较
+ * 沿 UScriptStruct 的 FProperty 树递归，叶子用 FProperty::Identical 比较，只记录不同的字段路径：
+ * - 嵌套结构体按成员展开（"Duration.Value"）；带原生比较的结构体（FGameplayTagContainer 等）整体作为一个字段（"AssetTags"）
+ * - TArray 按下标逐个比较（"Modifiers[2].Magnitude"），长度不同时多出或缺少的元素记为 "Modifiers[3]"
+ * - 静态数组同样带下标；TSet / TMap 整体作为一个字段
+ * 字段名为属性的 AuthoredName（与 JSON / Excel 列名一致）
+ */
+struct ABILITYEDITORHELPER_API FAbilityEditorStructDiff
+{
+	/** 比较同一结构体类型的两个实例，把变化的字段路径追加到 OutChangedFields */
+	static void CollectChangedFields(const UStruct* Struct, const void* OldData, const void* NewData, TArray<FString>& OutChangedFields);
+};
+
+/** 报告中的单行变化 */
+USTRUCT()
+struct FAbilityEditorImportRowChange
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName RowName;
+
+	/** 新增的行（没有 Fields） */
+	UPROPERTY()
+	bool bAdded = false;
+
+	/** 变化的字段路径，如 "Modifiers[2].Magnitude"、"AssetTags" */
+	UPROPERTY()
+	TArray<FString> Fields;
+};
+
+/**
+ * 增量导入的字段级变化报告：每个 DataTable 一份，每次导入覆盖，保存在 Saved/AbilityEditorHelper/Reports 下
+ * 只包含本次实际写入 DataTable 的行（取消时未处理的行已还原，不计入）
+ */
+USTRUCT()
+struct ABILITYEDITORHELPER_API FAbilityEditorImportReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString DataTablePath;
+
+	/** 数据来源文件名（JSON / .aebin / Excel） */
+	UPROPERTY()
+	FString Source;
+
+	/** 导入完成时间（UTC，ISO 8601） */
+	UPROPERTY()
+	FString Time;
+
+	UPROPERTY()
+	bool bCancelled = false;
+
+	UPROPERTY()
+	TArray<FAbilityEditorImportRowChange> Rows;
+
+	/** 因数据源中已不存在而从 DataTable 删除的行（Settings::bDeleteRowsRemovedFromSource） */
+	UPROPERTY()
+	TArray<FName> RemovedRows;
+
+	/** 报告文件路径：Saved/AbilityEditorHelper/Reports/Import_<DataTable 路径>.json */
+	static FString GetReportFilePath(const UDataTable* DataTable);
+
+	/** 写入报告文件（紧凑 JSON，不缩进） */
+	bool Save(const UDataTable* DataTable) const;
+};
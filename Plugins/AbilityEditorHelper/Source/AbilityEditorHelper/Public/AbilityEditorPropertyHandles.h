@@ -0,0 +1,56 @@
+// AbilityEditorPropertyHandles.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UnrealType.h"
+
+/**
+ * GE/GA 导入需要写入的受保护成员的反射句柄
+ * - 模块启动时按名称解析一次（早于启动的调用会在首次访问时解析），导入时不再逐行 FindPropertyByName
+ * - 解析失败（引擎版本改名或类型变化）的属性在解析时统一输出一次错误，对应句柄为 nullptr，导入时跳过该字段
+ */
+struct ABILITYEDITORHELPER_API FAbilityEditorPropertyHandles
+{
+	// === UGameplayEffect ===
+	FArrayProperty* GEComponents = nullptr;
+
+	// === UAbilitiesGameplayEffectComponent ===
+	FArrayProperty* GrantAbilityConfigs = nullptr;
+
+	// === UGameplayAbility：Cost / Cooldown ===
+	FClassProperty* CostGameplayEffectClass = nullptr;
+	FClassProperty* CooldownGameplayEffectClass = nullptr;
+
+	// === UGameplayAbility：Tags（FGameplayTagContainer） ===
+	FStructProperty* AbilityTags = nullptr;
+	FStructProperty* CancelAbilitiesWithTag = nullptr;
+	FStructProperty* BlockAbilitiesWithTag = nullptr;
+	FStructProperty* ActivationOwnedTags = nullptr;
+	FStructProperty* ActivationRequiredTags = nullptr;
+	FStructProperty* ActivationBlockedTags = nullptr;
+	FStructProperty* SourceRequiredTags = nullptr;
+	FStructProperty* SourceBlockedTags = nullptr;
+	FStructProperty* TargetRequiredTags = nullptr;
+	FStructProperty* TargetBlockedTags = nullptr;
+
+	// === UGameplayAbility：Triggers ===
+	FArrayProperty* AbilityTriggers = nullptr;
+
+	// === UGameplayAbility：Advanced ===
+	FBoolProperty* bServerRespectsRemoteAbilityCancellation = nullptr;
+	FBoolProperty* bReplicateInputDirectly = nullptr;
+	FBoolProperty* bRetriggerInstancedAbility = nullptr;
+
+	// === UGameplayAbility：策略（TEnumAsByte） ===
+	FByteProperty* NetExecutionPolicy = nullptr;
+	FByteProperty* NetSecurityPolicy = nullptr;
+	FByteProperty* InstancingPolicy = nullptr;
+	FByteProperty* ReplicationPolicy = nullptr;
+
+	/** 获取已解析的句柄表 */
+	static const FAbilityEditorPropertyHandles& Get();
+
+	/** 解析全部句柄（模块启动时调用） */
+	static void Initialize();
+};
@@ -0,0 +1,84 @@
+// AbilityEditorRowAssetType.h
+// 行类型注册：一种"DataTable 行 -> 生成资产"的映射
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/TopLevelAssetPath.h"
+
+class UDataTable;
+enum class EAbilityEditorGenerationTarget : uint8;
+
+/**
+ * 一种"DataTable 行 -> 生成资产"的映射（行类型）
+ * 导入管线按 解析 → 比较 → 解析引用 → 应用 → 保存 分阶段执行，各阶段对所有行类型通用：
+ * 行读取（JSON / .aebin / Excel）、增量清单、竞技场与并行绑定、配置印记、字段变化报告、删除同步、异步分帧与取消、包保存都在共享阶段中完成，
+ * 行类型只描述"表在哪、资产叫什么、如何把一行写进资产"
+ * GameplayEffect 与 GameplayAbility 是插件内置的两个行类型；项目模块可在启动时注册自己的行类型（AttributeSet 初始化表、GameplayCue 等）
+ */
+struct ABILITYEDITORHELPER_API FAbilityEditorRowAssetType
+{
+	/** 唯一名称（日志、导入接口参数），如 "GameplayEffect" */
+	FName Name;
+
+	/** 期望的行结构；DataTable 的行结构须为它或其派生类 */
+	const UScriptStruct* RowStruct = nullptr;
+
+	/** 生成资产名前缀（行名不含前缀时补上），如 "GE_" */
+	FString AssetPrefix;
+
+	/** 生成资产在资产注册表中的类（清理孤儿资产与生成状态查询按此过滤），如 UGameplayEffect 或 UBlueprint */
+	FTopLevelAssetPath AssetClassPath;
+
+	/**
+	 * 解析要导入的 DataTable 与资产输出目录（游戏线程，创建导入任务时调用）
+	 * @return  未配置或加载失败时返回 false
+	 */
+	TFunction<bool(UDataTable*& OutDataTable, FString& OutBasePath)> ResolveTable;
+
+	/**
+	 * 按一行配置创建或更新资产（游戏线程，批量导入作用域内）
+	 * @param RowData  行数据，类型为 DataTable 的行结构
+	 * @return         生成的资产；蓝图类资产可返回其生成类的 CDO（配置印记写到蓝图上）；失败返回 nullptr
+	 */
+	TFunction<UObject*(const FString& AssetPath, const uint8* RowData)> ApplyRow;
+
+	/** 可选：该行引用的其他资产路径；统一生成时同一次生成的被引用资产排在前面 */
+	TFunction<void(const uint8* RowData, TArray<FString>& OutReferencePaths)> GatherReferences;
+
+	/** 必填项是否完整 */
+	bool IsValid() const
+	{
+		return !Name.IsNone() && RowStruct && !AssetPrefix.IsEmpty() && AssetClassPath.IsValid() && ResolveTable && ApplyRow;
+	}
+};
+
+/**
+ * 行类型注册表（仅游戏线程）
+ * 导入任务创建时取得行类型的共享引用，导入进行中注销不影响该次导入
+ */
+class ABILITYEDITORHELPER_API FAbilityEditorRowAssetTypeRegistry
+{
+public:
+	/**
+	 * 注册行类型；同名类型已存在时替换
+	 * @return  必填项不完整时返回 false
+	 */
+	static bool Register(const FAbilityEditorRowAssetType& Type);
+
+	/** 注销行类型 */
+	static void Unregister(FName Name);
+
+	/** 按名称查找，未注册时返回空 */
+	static TSharedPtr<const FAbilityEditorRowAssetType> Find(FName Name);
+
+	/** 全部已注册的行类型（按注册顺序） */
+	static TArray<TSharedRef<const FAbilityEditorRowAssetType>> GetAll();
+
+	/** 内置行类型的名称 */
+	static FName GetBuiltInTypeName(EAbilityEditorGenerationTarget Target);
+
+	/** 注册 / 注销内置的 GameplayEffect 与 GameplayAbility 行类型（由插件模块启动与关闭时调用，实现位于 AbilityEditorHelperLibrary.cpp） */
+	static void RegisterBuiltInTypes();
+	static void UnregisterBuiltInTypes();
+};
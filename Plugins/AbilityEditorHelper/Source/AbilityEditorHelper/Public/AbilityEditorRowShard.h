@@ -0,0 +1,38 @@
+// AbilityEditorRowShard.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * DataTable 行分片：按行名的稳定哈希把行划分到 N 个分片，供多进程并行生成使用
+ * - 哈希只取决于小写行名（FName 比较不区分大小写），与进程、平台和行顺序无关
+ * - 每个分片生成的资产包互不重叠，各工作进程只保存自己分片的包
+ * - 默认不分片（Count = 1），所有行都属于当前进程
+ */
+struct ABILITYEDITORHELPER_API FAbilityEditorRowShard
+{
+	/** 分片总数（<= 1 表示不分片） */
+	int32 Count = 1;
+
+	/** 当前分片序号 [0, Count) */
+	int32 Index = 0;
+
+	/** 计算行所属的分片序号 */
+	static int32 GetShardIndex(FName RowName, int32 ShardCount);
+
+	/** 是否处于分片模式 */
+	bool IsSharded() const { return Count > 1; }
+
+	/** 行是否属于当前分片 */
+	bool Contains(FName RowName) const { return !IsSharded() || GetShardIndex(RowName, Count) == Index; }
+
+	/** 当前进程生效的分片（批量生成据此过滤行） */
+	static const FAbilityEditorRowShard& GetCurrent();
+
+	/**
+	 * 设置当前进程生效的分片（仅供命令行工作进程使用）
+	 * @return 参数无效时返回 false，且不修改当前分片
+	 */
+	static bool SetCurrent(int32 ShardCount, int32 ShardIndex);
+};
@@ -0,0 +1,25 @@
+// AbilityEditorStructHash.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 基于反射的结构体内容哈希（xxHash64）
+ * 直接遍历 UScriptStruct 的 FProperty 树并对值本身做哈希，不经过 JSON 文本序列化
+ * - 支持任意派生行结构（如 FGameplayEffectConfig 的项目扩展字段）、嵌套结构体与 TArray/TSet/TMap
+ * - FGameplayTagContainer 只对显式标签（GameplayTags）做哈希，ParentTags 为其派生数据
+ * - 变长数据（字符串、容器）带长度前缀，避免不同内容拼接后碰撞
+ * 用于增量导入的"是否变化"判断：两个值相同的结构体一定得到相同的哈希
+ */
+struct ABILITYEDITORHELPER_API FAbilityEditorStructHash
+{
+	/** 计算结构体实例的 64 位内容哈希 */
+	static uint64 HashStruct(const UScriptStruct* Struct, const void* StructData);
+
+	/** 计算 UObject 反射属性（含父类属性）的 64 位内容哈希，用于 Settings 等配置对象 */
+	static uint64 HashObjectProperties(const UObject* Object);
+
+	/** 只对指定名称的反射属性（按给定顺序）计算内容哈希；不存在的属性名被忽略 */
+	static uint64 HashObjectProperties(const UObject* Object, TConstArrayView<FName> PropertyNames);
+};